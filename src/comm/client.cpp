@@ -51,6 +51,25 @@ void Client::RecvValue(uint32_t &value) {
     }
 }
 
+void Client::SendBuffer(const uint32_t *data, const size_t length) {
+    // Send data
+    bool is_sent = internal::SendData(this->client_fd_, reinterpret_cast<const char *>(data), length * sizeof(uint32_t));
+    if (!is_sent) {
+        this->CloseSocket();
+        exit(EXIT_FAILURE);
+    }
+    this->total_bytes_sent_ += length * sizeof(uint32_t);
+}
+
+void Client::RecvBuffer(uint32_t *data, const size_t length) {
+    // Receive data
+    bool is_received = internal::RecvData(this->client_fd_, reinterpret_cast<char *>(data), length * sizeof(uint32_t));
+    if (!is_received) {
+        this->CloseSocket();
+        exit(EXIT_FAILURE);
+    }
+}
+
 std::string Client::GetHostAddress() {
     return this->host_address_;
 }
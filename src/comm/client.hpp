@@ -23,6 +23,10 @@ public:
 
     // TODO: SendVector, RecvVector, SendArray, RecvArray
 
+    void SendBuffer(const uint32_t *data, const size_t length);
+
+    void RecvBuffer(uint32_t *data, const size_t length);
+
     std::string GetHostAddress();
 
     int GetPortNumber();
@@ -88,6 +88,29 @@ void Server::RecvValue(uint32_t &value) {
     utils::Logger::TraceLog(LOCATION, "Received data: " + std::to_string(value), this->debug_);
 }
 
+void Server::SendBuffer(const uint32_t *data, const size_t length) {
+    // Send data
+    bool is_sent = internal::SendData(this->client_fd_, reinterpret_cast<const char *>(data), length * sizeof(uint32_t));
+    if (!is_sent) {
+        utils::Logger::FatalLog(LOCATION, "Failed to send buffer data");
+        this->CloseSocket();
+        exit(EXIT_FAILURE);
+    }
+    this->total_bytes_sent_ += length * sizeof(uint32_t);
+    utils::Logger::TraceLog(LOCATION, "Sent buffer of " + std::to_string(length) + " words", this->debug_);
+}
+
+void Server::RecvBuffer(uint32_t *data, const size_t length) {
+    // Receive data
+    bool is_received = internal::RecvData(this->client_fd_, reinterpret_cast<char *>(data), length * sizeof(uint32_t));
+    if (!is_received) {
+        utils::Logger::FatalLog(LOCATION, "Failed to receive buffer data");
+        this->CloseSocket();
+        exit(EXIT_FAILURE);
+    }
+    utils::Logger::TraceLog(LOCATION, "Received buffer of " + std::to_string(length) + " words", this->debug_);
+}
+
 int Server::GetPortNumber() const {
     return this->port_;
 }
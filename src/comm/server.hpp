@@ -25,6 +25,10 @@ public:
 
     void SendVector(std::vector<uint32_t> &vector);
 
+    void SendBuffer(const uint32_t *data, const size_t length);
+
+    void RecvBuffer(uint32_t *data, const size_t length);
+
     int GetPortNumber() const;
 
     uint32_t GetTotalBytesSent() const;
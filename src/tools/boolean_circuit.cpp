@@ -0,0 +1,398 @@
+#include "boolean_circuit.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+namespace tools {
+namespace circuit {
+
+BooleanCircuit::BooleanCircuit(const uint32_t num_wires, const uint32_t num_inputs, std::vector<uint32_t> output_wires)
+    : num_wires_(num_wires), num_inputs_(num_inputs), output_wires_(std::move(output_wires)) {
+    if (num_inputs > num_wires) {
+        throw std::invalid_argument("The number of inputs exceeds the number of wires.");
+    }
+}
+
+BooleanCircuit BooleanCircuit::FromBristol(const std::string &bristol_str) {
+    std::istringstream iss(bristol_str);
+    uint32_t           num_gates = 0, num_wires = 0, num_in_values = 0, num_out_values = 0;
+    if (!(iss >> num_gates >> num_wires >> num_in_values)) {
+        throw std::invalid_argument("Invalid Bristol header.");
+    }
+    std::vector<uint32_t> input_sizes(num_in_values);
+    for (uint32_t &size : input_sizes) {
+        iss >> size;
+    }
+    iss >> num_out_values;
+    std::vector<uint32_t> output_sizes(num_out_values);
+    for (uint32_t &size : output_sizes) {
+        iss >> size;
+    }
+    if (!iss) {
+        throw std::invalid_argument("Invalid Bristol header.");
+    }
+    const uint32_t num_inputs  = std::accumulate(input_sizes.begin(), input_sizes.end(), 0U);
+    const uint32_t num_outputs = std::accumulate(output_sizes.begin(), output_sizes.end(), 0U);
+    if (num_inputs + num_outputs > num_wires) {
+        throw std::invalid_argument("The inputs and outputs exceed the number of wires.");
+    }
+
+    // EQW gates only copy a wire, so they are resolved by aliasing instead of becoming gates
+    std::vector<uint32_t> alias(num_wires);
+    std::iota(alias.begin(), alias.end(), 0U);
+    auto resolve = [&](const uint32_t wire) {
+        if (wire >= num_wires) {
+            throw std::invalid_argument("Gate wire out of range.");
+        }
+        return alias[wire];
+    };
+
+    BooleanCircuit        circuit(num_wires, num_inputs, {});
+    std::vector<uint32_t> in, out;
+    std::string           type;
+    for (uint32_t g = 0; g < num_gates; g++) {
+        uint32_t num_in = 0, num_out = 0;
+        if (!(iss >> num_in >> num_out)) {
+            throw std::invalid_argument("Unexpected end of the Bristol gate list.");
+        }
+        in.resize(num_in);
+        out.resize(num_out);
+        for (uint32_t &wire : in) {
+            iss >> wire;
+        }
+        for (uint32_t &wire : out) {
+            iss >> wire;
+        }
+        if (!(iss >> type)) {
+            throw std::invalid_argument("Unexpected end of the Bristol gate list.");
+        }
+
+        if (type == "XOR" && num_in == 2 && num_out == 1) {
+            circuit.AddGate(GateType::kXor, resolve(in[0]), resolve(in[1]), out[0]);
+        } else if (type == "AND" && num_in == 2 && num_out == 1) {
+            circuit.AddGate(GateType::kAnd, resolve(in[0]), resolve(in[1]), out[0]);
+        } else if (type == "INV" && num_in == 1 && num_out == 1) {
+            circuit.AddGate(GateType::kInv, resolve(in[0]), 0, out[0]);
+        } else if (type == "EQW" && num_in == 1 && num_out == 1) {
+            alias[resolve(out[0])] = resolve(in[0]);
+        } else if (type == "MAND" && num_in == 2 * num_out) {
+            for (uint32_t i = 0; i < num_out; i++) {
+                circuit.AddGate(GateType::kAnd, resolve(in[i]), resolve(in[num_out + i]), out[i]);
+            }
+        } else {
+            throw std::invalid_argument("Unsupported Bristol gate: " + type);
+        }
+    }
+
+    for (uint32_t i = 0; i < num_outputs; i++) {
+        circuit.output_wires_.push_back(resolve(num_wires - num_outputs + i));
+    }
+    circuit.input_sizes_  = std::move(input_sizes);
+    circuit.output_sizes_ = std::move(output_sizes);
+    circuit.Levelize();
+    return circuit;
+}
+
+BooleanCircuit BooleanCircuit::LoadBristol(const std::string &file_path) {
+    std::ifstream file(file_path);
+    if (!file.is_open()) {
+        throw std::runtime_error("Failed to open the circuit file: " + file_path);
+    }
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return FromBristol(ss.str());
+}
+
+void BooleanCircuit::AddGate(const GateType type, const uint32_t in0, const uint32_t in1, const uint32_t out) {
+    this->gates_.push_back(Gate{type, in0, (type == GateType::kInv) ? in0 : in1, out});
+}
+
+void BooleanCircuit::Levelize() {
+    std::vector<uint32_t> level(this->num_wires_, 0);
+    std::vector<bool>     defined(this->num_wires_, false);
+    std::fill(defined.begin(), defined.begin() + this->num_inputs_, true);
+
+    // Compute the AND depth of each wire; gates are in topological order
+    this->num_ands_    = 0;
+    uint32_t max_level = 0;
+    for (const Gate &gate : this->gates_) {
+        if (gate.in0 >= this->num_wires_ || gate.in1 >= this->num_wires_ || gate.out >= this->num_wires_) {
+            throw std::invalid_argument("Gate wire out of range.");
+        }
+        if (!defined[gate.in0] || !defined[gate.in1]) {
+            throw std::invalid_argument("Gate input wire used before it is assigned: gates must be in topological order.");
+        }
+        if (defined[gate.out]) {
+            throw std::invalid_argument("Gate output wire assigned more than once.");
+        }
+        defined[gate.out] = true;
+        level[gate.out]   = std::max(level[gate.in0], level[gate.in1]);
+        if (gate.type == GateType::kAnd) {
+            level[gate.out]++;
+            this->num_ands_++;
+        }
+        max_level = std::max(max_level, level[gate.out]);
+    }
+    for (uint32_t wire : this->output_wires_) {
+        if (wire >= this->num_wires_ || !defined[wire]) {
+            throw std::invalid_argument("Output wire is not assigned.");
+        }
+    }
+
+    // Group the gates by level, keeping gate order inside each layer
+    this->layers_.assign(max_level + 1, CircuitLayer());
+    for (uint32_t i = 0; i < this->gates_.size(); i++) {
+        const Gate   &gate  = this->gates_[i];
+        CircuitLayer &layer = this->layers_[level[gate.out]];
+        if (gate.type == GateType::kAnd) {
+            layer.and_gates.push_back(i);
+        } else {
+            layer.linear_gates.push_back(i);
+        }
+    }
+}
+
+const std::vector<Gate> &BooleanCircuit::GetGates() const {
+    return this->gates_;
+}
+
+const std::vector<CircuitLayer> &BooleanCircuit::GetLayers() const {
+    return this->layers_;
+}
+
+const std::vector<uint32_t> &BooleanCircuit::GetOutputWires() const {
+    return this->output_wires_;
+}
+
+uint32_t BooleanCircuit::GetNumWires() const {
+    return this->num_wires_;
+}
+
+uint32_t BooleanCircuit::GetNumInputs() const {
+    return this->num_inputs_;
+}
+
+uint32_t BooleanCircuit::GetNumAndGates() const {
+    return this->num_ands_;
+}
+
+const std::vector<uint32_t> &BooleanCircuit::GetInputSizes() const {
+    return this->input_sizes_;
+}
+
+const std::vector<uint32_t> &BooleanCircuit::GetOutputSizes() const {
+    return this->output_sizes_;
+}
+
+uint32_t BooleanCircuit::GetDepth() const {
+    return this->layers_.empty() ? 0 : static_cast<uint32_t>(this->layers_.size() - 1);
+}
+
+void BitSlice(const std::vector<uint32_t> &bits, const uint32_t num_instances, const uint32_t num_wires, std::vector<uint32_t> &sliced) {
+    if (bits.size() != static_cast<size_t>(num_instances) * num_wires) {
+        throw std::invalid_argument("The number of bits does not match the instances and wires.");
+    }
+    const size_t num_words = (num_instances + 31) / 32;
+    sliced.assign(num_wires * num_words, 0);
+    for (size_t i = 0; i < num_instances; i++) {
+        for (size_t w = 0; w < num_wires; w++) {
+            sliced[w * num_words + i / 32] |= (bits[i * num_wires + w] & 1U) << (i % 32);
+        }
+    }
+}
+
+void UnBitSlice(const std::vector<uint32_t> &sliced, const uint32_t num_instances, const uint32_t num_wires, std::vector<uint32_t> &bits) {
+    const size_t num_words = (num_instances + 31) / 32;
+    if (sliced.size() != num_wires * num_words) {
+        throw std::invalid_argument("The number of sliced words does not match the instances and wires.");
+    }
+    bits.resize(static_cast<size_t>(num_instances) * num_wires);
+    for (size_t i = 0; i < num_instances; i++) {
+        for (size_t w = 0; w < num_wires; w++) {
+            bits[i * num_wires + w] = (sliced[w * num_words + i / 32] >> (i % 32)) & 1U;
+        }
+    }
+}
+
+CircuitEvaluator::CircuitEvaluator(const BooleanCircuit &circuit)
+    : circuit_(circuit), bss_() {
+}
+
+uint32_t CircuitEvaluator::GetNumTriples(const uint32_t num_words) const {
+    return this->circuit_.GetNumAndGates() * num_words;
+}
+
+void CircuitEvaluator::Evaluate(secret_sharing::Party &party, const uint32_t num_words, const secret_sharing::bts_t &btb_vec, const std::vector<uint32_t> &xb_vec, std::vector<uint32_t> &zb_vec) const {
+    const size_t words = num_words;
+    if (btb_vec.size() < this->GetNumTriples(num_words)) {
+        throw std::invalid_argument("Not enough Beaver triples for the circuit.");
+    }
+    if (xb_vec.size() != this->circuit_.GetNumInputs() * words) {
+        throw std::invalid_argument("The number of input shares does not match the circuit.");
+    }
+
+    const std::vector<Gate> &gates    = this->circuit_.GetGates();
+    const uint32_t           inv_mask = (party.GetId() == 0) ? ~0U : 0U;    // Only party 0 flips the bits of an INV gate
+    std::vector<uint32_t>    wire(this->circuit_.GetNumWires() * words);
+    std::copy(xb_vec.begin(), xb_vec.end(), wire.begin());
+
+    size_t bt_offset = 0;
+    for (const CircuitLayer &layer : this->circuit_.GetLayers()) {
+        const size_t num = layer.and_gates.size() * words;
+        if (num > 0) {
+            utils::Workspace::Frame frame(party.GetWorkspace());
+            uint32_t               *x = party.GetWorkspace().Allocate(num);
+            uint32_t               *y = party.GetWorkspace().Allocate(num);
+            uint32_t               *z = party.GetWorkspace().Allocate(num);
+            for (size_t i = 0; i < num; i++) {
+                const Gate &gate = gates[layer.and_gates[i / words]];
+                x[i]             = wire[gate.in0 * words + i % words];
+                y[i]             = wire[gate.in1 * words + i % words];
+            }
+            // Evaluate all AND gates of the layer in one batched round.
+            this->bss_.And(party, utils::Span<const secret_sharing::BeaverTriplet>(btb_vec.data() + bt_offset, num),
+                           utils::Span<const uint32_t>(x, num), utils::Span<const uint32_t>(y, num), utils::Span<uint32_t>(z, num));
+            for (size_t i = 0; i < num; i++) {
+                wire[gates[layer.and_gates[i / words]].out * words + i % words] = z[i];
+            }
+            bt_offset += num;
+        }
+        // Evaluate the linear gates locally.
+        for (uint32_t g : layer.linear_gates) {
+            const Gate &gate = gates[g];
+            for (size_t k = 0; k < words; k++) {
+                wire[gate.out * words + k] = (gate.type == GateType::kXor) ? wire[gate.in0 * words + k] ^ wire[gate.in1 * words + k] : wire[gate.in0 * words + k] ^ inv_mask;
+            }
+        }
+    }
+
+    const std::vector<uint32_t> &outputs = this->circuit_.GetOutputWires();
+    zb_vec.resize(outputs.size() * words);
+    for (size_t o = 0; o < outputs.size(); o++) {
+        std::copy_n(wire.begin() + outputs[o] * words, words, zb_vec.begin() + o * words);
+    }
+}
+
+MaskedCircuitEvaluator::MaskedCircuitEvaluator(const BooleanCircuit &circuit)
+    : circuit_(circuit), bss_() {
+}
+
+void MaskedCircuitEvaluator::GenerateMasks(const uint32_t num_words, CircuitMasks &masks) const {
+    const size_t words = num_words;
+    masks.num_words    = num_words;
+    masks.lambda.assign(static_cast<size_t>(this->circuit_.GetNumWires()) * words, 0);
+    masks.gamma.resize(static_cast<size_t>(this->circuit_.GetNumAndGates()) * words);
+
+    // Fresh masks for the input wires
+    for (size_t i = 0; i < static_cast<size_t>(this->circuit_.GetNumInputs()) * words; i++) {
+        masks.lambda[i] = rng::SecureRng::Rand32();
+    }
+
+    // Propagate the masks layer by layer, drawing fresh masks for the AND outputs
+    const std::vector<Gate> &gates  = this->circuit_.GetGates();
+    size_t                   and_id = 0;
+    for (const CircuitLayer &layer : this->circuit_.GetLayers()) {
+        for (uint32_t g : layer.and_gates) {
+            const Gate &gate = gates[g];
+            for (size_t k = 0; k < words; k++) {
+                masks.gamma[and_id * words + k]      = masks.lambda[gate.in0 * words + k] & masks.lambda[gate.in1 * words + k];
+                masks.lambda[gate.out * words + k] = rng::SecureRng::Rand32();
+            }
+            and_id++;
+        }
+        for (uint32_t g : layer.linear_gates) {
+            const Gate &gate = gates[g];
+            for (size_t k = 0; k < words; k++) {
+                masks.lambda[gate.out * words + k] = (gate.type == GateType::kXor)
+                                                         ? masks.lambda[gate.in0 * words + k] ^ masks.lambda[gate.in1 * words + k]
+                                                         : masks.lambda[gate.in0 * words + k];
+            }
+        }
+    }
+}
+
+std::pair<CircuitMasks, CircuitMasks> MaskedCircuitEvaluator::ShareMasks(const CircuitMasks &masks) const {
+    CircuitMasks masks_0, masks_1;
+    masks_0.num_words = masks_1.num_words = masks.num_words;
+    masks_0.lambda.resize(masks.lambda.size());
+    masks_1.lambda.resize(masks.lambda.size());
+    masks_0.gamma.resize(masks.gamma.size());
+    masks_1.gamma.resize(masks.gamma.size());
+    for (size_t i = 0; i < masks.lambda.size(); i++) {
+        masks_0.lambda[i] = rng::SecureRng::Rand32();
+        masks_1.lambda[i] = masks.lambda[i] ^ masks_0.lambda[i];
+    }
+    for (size_t i = 0; i < masks.gamma.size(); i++) {
+        masks_0.gamma[i] = rng::SecureRng::Rand32();
+        masks_1.gamma[i] = masks.gamma[i] ^ masks_0.gamma[i];
+    }
+    return std::make_pair(masks_0, masks_1);
+}
+
+void MaskedCircuitEvaluator::Evaluate(secret_sharing::Party &party, const CircuitMasks &masks, const std::vector<uint32_t> &xb_vec, std::vector<uint32_t> &zb_vec) const {
+    const size_t words = masks.num_words;
+    if (masks.lambda.size() != this->circuit_.GetNumWires() * words || masks.gamma.size() != this->circuit_.GetNumAndGates() * words) {
+        throw std::invalid_argument("The circuit masks do not match the circuit.");
+    }
+    if (xb_vec.size() != this->circuit_.GetNumInputs() * words) {
+        throw std::invalid_argument("The number of input shares does not match the circuit.");
+    }
+
+    const std::vector<Gate> &gates    = this->circuit_.GetGates();
+    utils::ThreadPool       &pool     = party.GetThreadPool();
+    const uint32_t           pub_mask = (party.GetId() == 0) ? ~0U : 0U;    // Only party 0 adds the public term
+    std::vector<uint32_t>    delta(this->circuit_.GetNumWires() * words);
+
+    // Open the masked inputs Delta = x ^ lambda in one round.
+    for (size_t i = 0; i < xb_vec.size(); i++) {
+        delta[i] = xb_vec[i] ^ masks.lambda[i];
+    }
+    this->bss_.Reconst(party, utils::Span<uint32_t>(delta.data(), xb_vec.size()));
+
+    size_t and_offset = 0;
+    for (const CircuitLayer &layer : this->circuit_.GetLayers()) {
+        const size_t num = layer.and_gates.size() * words;
+        if (num > 0) {
+            utils::Workspace::Frame frame(party.GetWorkspace());
+            uint32_t               *delta_out = party.GetWorkspace().Allocate(num);
+            // Calculate the own shares of the masked AND outputs.
+            pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+                for (size_t i = begin; i < end; i++) {
+                    const Gate &gate = gates[layer.and_gates[i / words]];
+                    const size_t k   = i % words;
+                    const uint32_t d0 = delta[gate.in0 * words + k], d1 = delta[gate.in1 * words + k];
+                    delta_out[i] = (pub_mask & d0 & d1) ^ (d0 & masks.lambda[gate.in1 * words + k]) ^ (d1 & masks.lambda[gate.in0 * words + k]) ^
+                                   masks.gamma[and_offset + i] ^ masks.lambda[gate.out * words + k];
+                }
+            });
+            // Open one masked value per AND gate.
+            this->bss_.Reconst(party, utils::Span<uint32_t>(delta_out, num));
+            for (size_t i = 0; i < num; i++) {
+                delta[gates[layer.and_gates[i / words]].out * words + i % words] = delta_out[i];
+            }
+            and_offset += num;
+        }
+        // Evaluate the linear gates on the public masked values.
+        for (uint32_t g : layer.linear_gates) {
+            const Gate &gate = gates[g];
+            for (size_t k = 0; k < words; k++) {
+                delta[gate.out * words + k] = (gate.type == GateType::kXor) ? delta[gate.in0 * words + k] ^ delta[gate.in1 * words + k] : ~delta[gate.in0 * words + k];
+            }
+        }
+    }
+
+    // Unmask the outputs: z = Delta ^ lambda, where only party 0 adds the public term Delta.
+    const std::vector<uint32_t> &outputs = this->circuit_.GetOutputWires();
+    zb_vec.resize(outputs.size() * words);
+    for (size_t o = 0; o < outputs.size(); o++) {
+        for (size_t k = 0; k < words; k++) {
+            zb_vec[o * words + k] = (pub_mask & delta[outputs[o] * words + k]) ^ masks.lambda[outputs[o] * words + k];
+        }
+    }
+}
+
+}    // namespace circuit
+}    // namespace tools
@@ -0,0 +1,259 @@
+#ifndef BOOLEAN_CIRCUIT_H_
+#define BOOLEAN_CIRCUIT_H_
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "secret_sharing.hpp"
+
+namespace tools {
+namespace circuit {
+
+/**
+ * @brief Gates supported in a Boolean circuit.
+ */
+enum class GateType {
+    kXor,
+    kAnd,
+    kInv,
+};
+
+/**
+ * @brief A single gate of a Boolean circuit.
+ */
+struct Gate {
+    GateType type; /**< Operation performed by the gate. */
+    uint32_t in0;  /**< First input wire. */
+    uint32_t in1;  /**< Second input wire (unused for kInv). */
+    uint32_t out;  /**< Output wire. */
+};
+
+/**
+ * @brief Layer of a levelized Boolean circuit.
+ *
+ * The AND gates of a layer are evaluated together in one batched round, followed by the
+ * linear (XOR/INV) gates that become computable afterwards (in gate order).
+ */
+struct CircuitLayer {
+    std::vector<uint32_t> and_gates;    /**< AND gates evaluated in one batched round. */
+    std::vector<uint32_t> linear_gates; /**< XOR/INV gates evaluated locally after the round. */
+};
+
+/**
+ * @class BooleanCircuit
+ * @brief Boolean circuit over numbered wires, levelized by AND depth.
+ *
+ * The input wires are 0, ..., num_inputs - 1. Every other wire is the output of exactly
+ * one gate, and gates must be added in topological order.
+ */
+class BooleanCircuit {
+public:
+    BooleanCircuit() = default;
+
+    /**
+     * @brief Constructs an empty BooleanCircuit.
+     *
+     * @param num_wires The total number of wires.
+     * @param num_inputs The number of input wires.
+     * @param output_wires The output wires in output order.
+     */
+    BooleanCircuit(const uint32_t num_wires, const uint32_t num_inputs, std::vector<uint32_t> output_wires);
+
+    /**
+     * @brief Parses a levelized circuit from the Bristol Fashion format.
+     *
+     * The header holds the number of gates and wires, followed by the number and bit
+     * lengths of the input values and of the output values. The inputs are the first
+     * wires and the outputs the last ones. XOR, AND, INV, EQW and MAND gates are supported;
+     * EQW is resolved by wire aliasing and MAND is split into AND gates.
+     *
+     * @param bristol_str The string describing the circuit.
+     * @return The parsed and levelized circuit.
+     */
+    static BooleanCircuit FromBristol(const std::string &bristol_str);
+
+    /**
+     * @brief Loads a levelized circuit from a Bristol Fashion file.
+     *
+     * @param file_path The path of the circuit file.
+     * @return The parsed and levelized circuit.
+     */
+    static BooleanCircuit LoadBristol(const std::string &file_path);
+
+    /**
+     * @brief Adds a gate to the circuit.
+     *
+     * @param type The operation of the gate.
+     * @param in0 The first input wire.
+     * @param in1 The second input wire (ignored for kInv).
+     * @param out The output wire.
+     */
+    void AddGate(const GateType type, const uint32_t in0, const uint32_t in1, const uint32_t out);
+
+    /**
+     * @brief Checks the wiring and computes the AND-depth layers.
+     *
+     * The level of a wire is the maximum level of the gate inputs, plus one for AND gates.
+     * Layer 0 holds the linear gates over the inputs only and has no AND gates.
+     */
+    void Levelize();
+
+    const std::vector<Gate>         &GetGates() const;
+    const std::vector<CircuitLayer> &GetLayers() const;
+    const std::vector<uint32_t>     &GetOutputWires() const;
+    uint32_t                         GetNumWires() const;
+    uint32_t                         GetNumInputs() const;
+    uint32_t                         GetNumAndGates() const;
+    const std::vector<uint32_t>     &GetInputSizes() const;
+    const std::vector<uint32_t>     &GetOutputSizes() const;
+
+    /**
+     * @brief Gets the AND depth of the circuit, i.e., the number of interactive rounds.
+     */
+    uint32_t GetDepth() const;
+
+private:
+    uint32_t                  num_wires_  = 0; /**< Total number of wires. */
+    uint32_t                  num_inputs_ = 0; /**< Number of input wires. */
+    uint32_t                  num_ands_   = 0; /**< Number of AND gates. */
+    std::vector<uint32_t>     output_wires_;   /**< Output wires in output order. */
+    std::vector<uint32_t>     input_sizes_;    /**< Bit lengths of the input values (Bristol only). */
+    std::vector<uint32_t>     output_sizes_;   /**< Bit lengths of the output values (Bristol only). */
+    std::vector<Gate>         gates_;          /**< Gates in topological order. */
+    std::vector<CircuitLayer> layers_;         /**< Layers computed by Levelize(). */
+};
+
+/**
+ * @brief Packs per-instance wire bits into bit-sliced words.
+ *
+ * Bit 'j' of word 'k' of wire 'w' holds instance 32 * k + j, so one packed And evaluates
+ * 32 instances per word. Slicing commutes with XOR, so it applies to Boolean shares as well.
+ *
+ * @param bits The bits (0 or 1), bits[i * num_wires + w] for instance 'i' and wire 'w'.
+ * @param num_instances The number of circuit instances.
+ * @param num_wires The number of wires per instance.
+ * @param sliced The sliced words, sliced[w * num_words + k] with num_words = ceil(num_instances / 32).
+ */
+void BitSlice(const std::vector<uint32_t> &bits, const uint32_t num_instances, const uint32_t num_wires, std::vector<uint32_t> &sliced);
+
+/**
+ * @brief Unpacks bit-sliced words into per-instance wire bits (inverse of BitSlice).
+ *
+ * @param sliced The sliced words, sliced[w * num_words + k].
+ * @param num_instances The number of circuit instances.
+ * @param num_wires The number of wires per instance.
+ * @param bits The bits, bits[i * num_wires + w] for instance 'i' and wire 'w'.
+ */
+void UnBitSlice(const std::vector<uint32_t> &sliced, const uint32_t num_instances, const uint32_t num_wires, std::vector<uint32_t> &bits);
+
+/**
+ * @class CircuitEvaluator
+ * @brief Layer-by-layer evaluation of a Boolean circuit with Beaver triples.
+ *
+ * The XOR/INV gates of a layer are evaluated locally and all its AND gates by one batched
+ * BooleanSecretSharing::And, so an evaluation takes GetDepth() rounds. Every wire holds
+ * 'num_words' bit-sliced words (see BitSlice) and consumes packed Beaver triples
+ * (BooleanSecretSharing::GeneratePackedBeaverTriples).
+ */
+class CircuitEvaluator {
+public:
+    /**
+     * @brief Constructs a CircuitEvaluator for a levelized circuit.
+     *
+     * @param circuit The levelized Boolean circuit.
+     */
+    explicit CircuitEvaluator(const BooleanCircuit &circuit);
+
+    /**
+     * @brief Gets the number of packed Beaver triples consumed by one evaluation.
+     *
+     * @param num_words The number of packed words per wire.
+     */
+    uint32_t GetNumTriples(const uint32_t num_words) const;
+
+    /**
+     * @brief Evaluates the circuit on Boolean shares of its inputs.
+     *
+     * @param party The party that evaluates the circuit.
+     * @param num_words The number of packed words per wire.
+     * @param btb_vec The packed Beaver triple shares (at least GetNumTriples(num_words)).
+     * @param xb_vec The input shares, xb_vec[i * num_words + k] for input wire 'i'.
+     * @param zb_vec The output shares, zb_vec[o * num_words + k] for the o-th output wire.
+     */
+    void Evaluate(secret_sharing::Party &party, const uint32_t num_words, const secret_sharing::bts_t &btb_vec, const std::vector<uint32_t> &xb_vec, std::vector<uint32_t> &zb_vec) const;
+
+private:
+    const BooleanCircuit                &circuit_; /**< Circuit to evaluate. */
+    secret_sharing::BooleanSecretSharing bss_;     /**< Boolean secret sharing. */
+};
+
+/**
+ * @brief Function-dependent preprocessing of a circuit (plain values or shares of one party).
+ *
+ * Every wire 'w' carries a random mask lambda_w: fresh for input wires and AND outputs,
+ * and lambda_in0 ^ lambda_in1 (or lambda_in0) for XOR (or INV) outputs. Each AND gate
+ * additionally carries gamma = lambda_in0 & lambda_in1. Every wire holds 'num_words'
+ * packed words, so 32 * num_words circuit instances run side by side.
+ */
+struct CircuitMasks {
+    uint32_t              num_words = 0; /**< Number of packed words per wire. */
+    std::vector<uint32_t> lambda;        /**< Wire masks, lambda[w * num_words + k]. */
+    std::vector<uint32_t> gamma;         /**< Mask products of the AND gates in layer order. */
+};
+
+/**
+ * @class MaskedCircuitEvaluator
+ * @brief Mask-and-open evaluation of a Boolean circuit (Turbospeedz/ABY2.0 style).
+ *
+ * Online, both parties hold the public masked value Delta_w = v_w ^ lambda_w of every wire.
+ * XOR and INV gates are local, and an AND gate opens only the single value
+ *   Delta_out = (Delta_0 & Delta_1) ^ (Delta_0 & lambda_1) ^ (Delta_1 & lambda_0) ^ gamma ^ lambda_out,
+ * instead of the two differences (d, e) opened by BooleanSecretSharing::And.
+ * An evaluation opens the inputs once and then takes one round per AND layer.
+ */
+class MaskedCircuitEvaluator {
+public:
+    /**
+     * @brief Constructs a MaskedCircuitEvaluator for a levelized circuit.
+     *
+     * @param circuit The levelized Boolean circuit.
+     */
+    explicit MaskedCircuitEvaluator(const BooleanCircuit &circuit);
+
+    /**
+     * @brief Generates the plain wire masks and mask products for the circuit.
+     *
+     * @param num_words The number of packed words per wire.
+     * @param masks The generated circuit masks.
+     */
+    void GenerateMasks(const uint32_t num_words, CircuitMasks &masks) const;
+
+    /**
+     * @brief Splits plain circuit masks into Boolean shares for the two parties.
+     *
+     * @param masks The plain circuit masks.
+     * @return A pair of circuit mask shares for party 0 and party 1.
+     */
+    std::pair<CircuitMasks, CircuitMasks> ShareMasks(const CircuitMasks &masks) const;
+
+    /**
+     * @brief Evaluates the circuit on Boolean shares of its inputs.
+     *
+     * @param party The party that evaluates the circuit.
+     * @param masks The circuit mask shares of the party.
+     * @param xb_vec The input shares, xb_vec[i * num_words + k] for input wire 'i'.
+     * @param zb_vec The output shares, zb_vec[o * num_words + k] for the o-th output wire.
+     */
+    void Evaluate(secret_sharing::Party &party, const CircuitMasks &masks, const std::vector<uint32_t> &xb_vec, std::vector<uint32_t> &zb_vec) const;
+
+private:
+    const BooleanCircuit                &circuit_; /**< Circuit to evaluate. */
+    secret_sharing::BooleanSecretSharing bss_;     /**< Boolean secret sharing. */
+};
+
+}    // namespace circuit
+}    // namespace tools
+
+#endif    // BOOLEAN_CIRCUIT_H_
@@ -0,0 +1,238 @@
+#include "comparison.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+
+#include "../utils/utils.hpp"
+
+namespace tools {
+namespace secret_sharing {
+
+namespace {
+
+/**
+ * @brief Checks that 'ct' holds the correlated randomness for 'num_cmp' comparisons and 'num_sel' selections.
+ */
+void CheckTriples(const ComparisonTriples &ct, const size_t num_cmp, const size_t num_sel, const size_t a2b_count) {
+    if (ct.btp_vec.size() < num_cmp * a2b_count || ct.dabit_vec.size() < num_cmp || ct.bt_vec.size() < num_sel) {
+        throw std::invalid_argument("Not enough correlated randomness for the comparisons.");
+    }
+}
+
+/**
+ * @brief Gets the smallest power of two that is not less than 'num'.
+ */
+size_t NextPowerOfTwo(const size_t num) {
+    size_t n = 1;
+    while (n < num) {
+        n <<= 1;
+    }
+    return n;
+}
+
+}    // namespace
+
+Comparison::Comparison(const uint32_t bitsize)
+    : bitsize_(bitsize), conv_(bitsize), ass_(bitsize) {
+}
+
+void Comparison::GenerateTriples(const uint32_t num_cmp, const uint32_t num_sel, ComparisonTriples &ct) const {
+    BooleanSecretSharing().GeneratePackedBeaverTriples(num_cmp * this->conv_.GetA2BTripleCount(), ct.btp_vec);
+    this->conv_.GenerateDaBits(num_cmp, ct.dabit_vec);
+    ct.bt_vec.resize(num_sel);
+    this->ass_.GenerateBeaverTriples(num_sel, ct.bt_vec);
+}
+
+cmpts_t Comparison::ShareTriples(const ComparisonTriples &ct) const {
+    ComparisonTriples ct_0, ct_1;
+    std::tie(ct_0.btp_vec, ct_1.btp_vec)     = BooleanSecretSharing().SharePackedBeaverTriples(ct.btp_vec);
+    std::tie(ct_0.dabit_vec, ct_1.dabit_vec) = this->conv_.ShareDaBits(ct.dabit_vec);
+    std::tie(ct_0.bt_vec, ct_1.bt_vec)       = this->ass_.ShareBeaverTriples(ct.bt_vec);
+    return std::make_pair(ct_0, ct_1);
+}
+
+std::pair<uint32_t, uint32_t> Comparison::GetMaxCount(const uint32_t num) const {
+    if (num == 0) {
+        throw std::invalid_argument("The vector of values must not be empty.");
+    }
+    return std::make_pair(num - 1, num - 1);
+}
+
+std::pair<uint32_t, uint32_t> Comparison::GetArgMaxCount(const uint32_t num) const {
+    if (num == 0) {
+        throw std::invalid_argument("The vector of values must not be empty.");
+    }
+    return std::make_pair(num - 1, 2 * (num - 1));
+}
+
+void Comparison::LessThan(Party &party, const ComparisonTriples &ct, const std::vector<uint32_t> &x_vec, const std::vector<uint32_t> &y_vec, std::vector<uint32_t> &lt_vec) const {
+    size_t num = x_vec.size();
+    if (y_vec.size() != num) {
+        throw std::invalid_argument("The sizes of the operands must match.");
+    }
+    if (ct.dabit_vec.size() < num) {
+        throw std::invalid_argument("Not enough daBits for the comparisons.");
+    }
+    lt_vec.resize(num);
+    this->LessThan(party, ct.btp_vec, ct.dabit_vec, x_vec, y_vec, lt_vec);
+}
+
+uint32_t Comparison::Max(Party &party, const ComparisonTriples &ct, const std::vector<uint32_t> &x_vec) const {
+    uint32_t max = 0, index = 0;
+    this->Tournament(party, ct, x_vec, false, max, index);
+    return max;
+}
+
+void Comparison::ArgMax(Party &party, const ComparisonTriples &ct, const std::vector<uint32_t> &x_vec, uint32_t &max, uint32_t &index) const {
+    this->Tournament(party, ct, x_vec, true, max, index);
+}
+
+std::pair<uint32_t, uint32_t> Comparison::GetSortCount(const uint32_t num) const {
+    // A bitonic network over 2^k values has k(k + 1)/2 layers of 2^(k-1) comparators.
+    const size_t n = NextPowerOfTwo(num);
+    size_t       k = 0;
+    while ((static_cast<size_t>(1) << k) < n) {
+        k++;
+    }
+    const uint32_t num_cmp = static_cast<uint32_t>((n / 2) * k * (k + 1) / 2);
+    return std::make_pair(num_cmp, num_cmp);
+}
+
+void Comparison::Sort(Party &party, const ComparisonTriples &ct, const std::vector<uint32_t> &x_vec, std::vector<uint32_t> &z_vec) const {
+    const size_t   num       = x_vec.size();
+    const size_t   n         = NextPowerOfTwo(num);
+    const uint32_t a2b_count = this->conv_.GetA2BTripleCount();
+    const auto     count     = this->GetSortCount(static_cast<uint32_t>(num));
+    CheckTriples(ct, count.first, count.second, a2b_count);
+    // Layer buffers of the whole network, taken once from the workspace
+    utils::Workspace::Frame frame(party.GetWorkspace());
+    uint32_t               *val_vec = party.GetWorkspace().Allocate(n);
+    uint32_t               *lo_idx  = party.GetWorkspace().Allocate(n / 2);
+    uint32_t               *hi_idx  = party.GetWorkspace().Allocate(n / 2);
+    uint32_t               *lhs     = party.GetWorkspace().Allocate(n / 2);
+    uint32_t               *rhs     = party.GetWorkspace().Allocate(n / 2);
+    uint32_t               *lt_vec  = party.GetWorkspace().Allocate(n / 2);
+    uint32_t               *min_vec = party.GetWorkspace().Allocate(n / 2);
+    // Pad with the largest value, shared as (2^(bitsize - 1) - 1, 0), so the padding sorts to the end.
+    std::copy(x_vec.begin(), x_vec.end(), val_vec);
+    std::fill(val_vec + num, val_vec + n, (party.GetId() == 0) ? (1U << (this->bitsize_ - 1)) - 1 : 0U);
+
+    size_t offset = 0;
+    for (size_t k = 2; k <= n; k <<= 1) {
+        for (size_t j = k / 2; j > 0; j >>= 1) {
+            // Collect the comparators of the layer; the minimum goes to lo_idx.
+            size_t num_pairs = 0;
+            for (size_t i = 0; i < n; i++) {
+                size_t l = i ^ j;
+                if (l > i) {
+                    const bool ascending = (i & k) == 0;
+                    lo_idx[num_pairs]    = static_cast<uint32_t>(ascending ? i : l);
+                    hi_idx[num_pairs]    = static_cast<uint32_t>(ascending ? l : i);
+                    num_pairs++;
+                }
+            }
+            for (size_t p = 0; p < num_pairs; p++) {
+                lhs[p] = val_vec[lo_idx[p]];
+                rhs[p] = val_vec[hi_idx[p]];
+            }
+            // Compare all pairs of the layer in one batch: swap if hi < lo.
+            utils::Span<const uint32_t> lhs_layer(lhs, num_pairs), rhs_layer(rhs, num_pairs);
+            this->LessThan(party, utils::Span<const BeaverTriplet>(ct.btp_vec).subspan(offset * a2b_count, num_pairs * a2b_count),
+                           utils::Span<const DaBit>(ct.dabit_vec).subspan(offset, num_pairs), rhs_layer, lhs_layer, utils::Span<uint32_t>(lt_vec, num_pairs));
+            // Select the minima in one batch; the maxima follow locally as lo + hi - min.
+            this->ass_.Select(party, utils::Span<const BeaverTriplet>(ct.bt_vec).subspan(offset, num_pairs), utils::Span<const uint32_t>(lt_vec, num_pairs), rhs_layer, lhs_layer, utils::Span<uint32_t>(min_vec, num_pairs));
+            for (size_t p = 0; p < num_pairs; p++) {
+                val_vec[lo_idx[p]] = min_vec[p];
+                val_vec[hi_idx[p]] = utils::Mod(lhs[p] + rhs[p] - min_vec[p], this->bitsize_);
+            }
+            offset += num_pairs;
+        }
+    }
+    z_vec.assign(val_vec, val_vec + num);
+}
+
+void Comparison::Tournament(Party &party, const ComparisonTriples &ct, const std::vector<uint32_t> &x_vec, const bool with_index, uint32_t &max, uint32_t &index) const {
+    if (x_vec.empty()) {
+        throw std::invalid_argument("The vector of values must not be empty.");
+    }
+    const size_t   num       = x_vec.size();
+    const uint32_t a2b_count = this->conv_.GetA2BTripleCount();
+    const auto     count     = with_index ? this->GetArgMaxCount(static_cast<uint32_t>(num)) : this->GetMaxCount(static_cast<uint32_t>(num));
+    CheckTriples(ct, count.first, count.second, a2b_count);
+    // Level buffers of the whole tree, taken once from the workspace; a level selects at most 'num' values
+    utils::Workspace::Frame frame(party.GetWorkspace());
+    uint32_t               *val_vec = party.GetWorkspace().Allocate(num);
+    uint32_t               *idx_vec = party.GetWorkspace().Allocate(num);
+    uint32_t               *lhs     = party.GetWorkspace().Allocate(num);
+    uint32_t               *rhs     = party.GetWorkspace().Allocate(num);
+    uint32_t               *b_vec   = party.GetWorkspace().Allocate(num);
+    uint32_t               *z_vec   = party.GetWorkspace().Allocate(num);
+    std::copy(x_vec.begin(), x_vec.end(), val_vec);
+    for (size_t i = 0; i < num; i++) {
+        // The public indices are shared as (i, 0).
+        idx_vec[i] = (party.GetId() == 0) ? static_cast<uint32_t>(i) : 0U;
+    }
+
+    size_t cmp_offset = 0, sel_offset = 0, num_vals = num;
+    while (num_vals > 1) {
+        const size_t num_pairs = num_vals / 2;
+        const size_t num_sel   = with_index ? 2 * num_pairs : num_pairs;
+        // Pair up the values (and their indices behind them).
+        for (size_t i = 0; i < num_pairs; i++) {
+            lhs[i] = val_vec[2 * i];
+            rhs[i] = val_vec[2 * i + 1];
+            if (with_index) {
+                lhs[num_pairs + i] = idx_vec[2 * i];
+                rhs[num_pairs + i] = idx_vec[2 * i + 1];
+            }
+        }
+        // Compare all pairs of the level in one batch; the comparison bits go to the front of the selectors.
+        this->LessThan(party, utils::Span<const BeaverTriplet>(ct.btp_vec).subspan(cmp_offset * a2b_count, num_pairs * a2b_count),
+                       utils::Span<const DaBit>(ct.dabit_vec).subspan(cmp_offset, num_pairs), utils::Span<const uint32_t>(lhs, num_pairs), utils::Span<const uint32_t>(rhs, num_pairs), utils::Span<uint32_t>(b_vec, num_pairs));
+
+        // Select the winners (and their indices) in one batch: lhs + [lhs < rhs] * (rhs - lhs).
+        if (with_index) {
+            std::copy(b_vec, b_vec + num_pairs, b_vec + num_pairs);
+        }
+        this->ass_.Select(party, utils::Span<const BeaverTriplet>(ct.bt_vec).subspan(sel_offset, num_sel), utils::Span<const uint32_t>(b_vec, num_sel),
+                          utils::Span<const uint32_t>(rhs, num_sel), utils::Span<const uint32_t>(lhs, num_sel), utils::Span<uint32_t>(z_vec, num_sel));
+        cmp_offset += num_pairs;
+        sel_offset += num_sel;
+
+        // The unpaired last value advances to the next level.
+        const bool     has_odd = (num_vals % 2) == 1;
+        const uint32_t odd_val = val_vec[num_vals - 1];
+        const uint32_t odd_idx = idx_vec[num_vals - 1];
+        std::copy(z_vec, z_vec + num_pairs, val_vec);
+        if (with_index) {
+            std::copy(z_vec + num_pairs, z_vec + num_sel, idx_vec);
+        }
+        if (has_odd) {
+            val_vec[num_pairs] = odd_val;
+            idx_vec[num_pairs] = odd_idx;
+        }
+        num_vals = num_pairs + (has_odd ? 1 : 0);
+    }
+    max   = val_vec[0];
+    index = with_index ? idx_vec[0] : 0U;
+}
+
+void Comparison::LessThan(Party &party, utils::Span<const BeaverTriplet> btp_vec, utils::Span<const DaBit> dabit_vec, utils::Span<const uint32_t> x_vec, utils::Span<const uint32_t> y_vec, utils::Span<uint32_t> lt_vec) const {
+    size_t num = lt_vec.size();
+    utils::Workspace::Frame frame(party.GetWorkspace());
+    uint32_t               *d_vec  = party.GetWorkspace().Allocate(num);
+    uint32_t               *db_vec = party.GetWorkspace().Allocate(num);
+    // [x < y] is the most significant bit of x - y.
+    for (size_t i = 0; i < num; i++) {
+        d_vec[i] = utils::Mod(x_vec[i] - y_vec[i], this->bitsize_);
+    }
+    this->conv_.A2B(party, btp_vec, utils::Span<const uint32_t>(d_vec, num), utils::Span<uint32_t>(db_vec, num));
+    for (size_t i = 0; i < num; i++) {
+        db_vec[i] = (db_vec[i] >> (this->bitsize_ - 1)) & 1U;
+    }
+    this->conv_.B2A(party, dabit_vec, utils::Span<const uint32_t>(db_vec, num), lt_vec);
+}
+
+}    // namespace secret_sharing
+}    // namespace tools
@@ -0,0 +1,164 @@
+#ifndef COMPARISON_H_
+#define COMPARISON_H_
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "secret_sharing.hpp"
+#include "share_conversion.hpp"
+
+namespace tools {
+namespace secret_sharing {
+
+/**
+ * @brief Correlated randomness consumed by batched comparisons (plain values or shares of one party).
+ *
+ * Every comparison consumes ShareConversion::GetA2BTripleCount() packed Boolean triples and
+ * one daBit, and every selection one arithmetic Beaver triple. Each member is consumed from
+ * the front in evaluation order.
+ */
+struct ComparisonTriples {
+    bts_t    btp_vec;   /**< Packed Boolean Beaver triples for the A2B of the differences. */
+    dabits_t dabit_vec; /**< daBits converting the comparison bits to additive shares. */
+    bts_t    bt_vec;    /**< Arithmetic Beaver triples for the selections. */
+};
+
+using cmpts_t = std::pair<ComparisonTriples, ComparisonTriples>;
+
+/**
+ * @class Comparison
+ * @brief Batched secure comparison, maximum, argmax and sorting over additive shares.
+ *
+ * x < y is the most significant bit of x - y, which is extracted with the log-depth A2B of
+ * ShareConversion and converted back to an additive bit with a daBit. The result is exact
+ * when |x - y| < 2^(bitsize - 1), e.g. for values in [0, 2^(bitsize - 1)).
+ *
+ * Max and ArgMax reduce the values with a tournament tree: all pairwise comparisons of one
+ * tree level run as one batched LessThan followed by one batched Select, so n values take
+ * ceil(log2(n)) comparison levels. Sort applies the same batching to the layers of a
+ * bitonic sorting network.
+ */
+class Comparison {
+public:
+    /**
+     * @brief Constructs a Comparison object.
+     *
+     * @param bitsize The bit size of the arithmetic ring.
+     */
+    Comparison(const uint32_t bitsize = 32);
+
+    /**
+     * @brief Generates the correlated randomness for comparisons and selections.
+     *
+     * @param num_cmp The number of comparisons.
+     * @param num_sel The number of selections.
+     * @param ct The generated correlated randomness.
+     */
+    void GenerateTriples(const uint32_t num_cmp, const uint32_t num_sel, ComparisonTriples &ct) const;
+
+    /**
+     * @brief Shares the correlated randomness for comparisons and selections.
+     *
+     * @param ct The plain correlated randomness.
+     * @return A pair of shares for party 0 and party 1.
+     */
+    cmpts_t ShareTriples(const ComparisonTriples &ct) const;
+
+    /**
+     * @brief Gets the number of comparisons and selections consumed by Max.
+     *
+     * @param num The number of values.
+     * @return The number of comparisons and the number of selections.
+     */
+    std::pair<uint32_t, uint32_t> GetMaxCount(const uint32_t num) const;
+
+    /**
+     * @brief Gets the number of comparisons and selections consumed by ArgMax.
+     *
+     * @param num The number of values.
+     * @return The number of comparisons and the number of selections.
+     */
+    std::pair<uint32_t, uint32_t> GetArgMaxCount(const uint32_t num) const;
+
+    /**
+     * @brief Compares two vectors of secret-shared values element-wise.
+     *
+     * Consumes the front of 'btp_vec' and 'dabit_vec' of 'ct' (see ComparisonTriples).
+     *
+     * @param party The party object representing the current party.
+     * @param ct The correlated randomness of the party.
+     * @param x_vec The vector of secret-shared values x.
+     * @param y_vec The vector of secret-shared values y.
+     * @param lt_vec The vector to store the additive shares of the bits [x < y].
+     */
+    void LessThan(Party &party, const ComparisonTriples &ct, const std::vector<uint32_t> &x_vec, const std::vector<uint32_t> &y_vec, std::vector<uint32_t> &lt_vec) const;
+
+    /**
+     * @brief Computes the maximum of a vector of secret-shared values.
+     *
+     * @param party The party object representing the current party.
+     * @param ct The correlated randomness of the party (see GetMaxCount).
+     * @param x_vec The vector of secret-shared values.
+     * @return The secret-shared maximum.
+     */
+    uint32_t Max(Party &party, const ComparisonTriples &ct, const std::vector<uint32_t> &x_vec) const;
+
+    /**
+     * @brief Computes the maximum and its index of a vector of secret-shared values.
+     *
+     * The index is selected alongside the value in the same Select batch. On ties the
+     * smaller index wins.
+     *
+     * @param party The party object representing the current party.
+     * @param ct The correlated randomness of the party (see GetArgMaxCount).
+     * @param x_vec The vector of secret-shared values.
+     * @param max The secret-shared maximum.
+     * @param index The secret-shared index of the maximum.
+     */
+    void ArgMax(Party &party, const ComparisonTriples &ct, const std::vector<uint32_t> &x_vec, uint32_t &max, uint32_t &index) const;
+
+    /**
+     * @brief Gets the number of comparisons and selections consumed by Sort.
+     *
+     * @param num The number of values.
+     * @return The number of comparisons and the number of selections.
+     */
+    std::pair<uint32_t, uint32_t> GetSortCount(const uint32_t num) const;
+
+    /**
+     * @brief Sorts a vector of secret-shared values in ascending order.
+     *
+     * Runs a bitonic sorting network over the values padded to a power of two 2^k with the
+     * largest value 2^(bitsize - 1) - 1. Every compare-and-swap of a network layer is
+     * evaluated in one batched LessThan and one batched Select (the maximum is obtained
+     * locally as x + y - min), so the k(k + 1)/2 layers take a number of rounds that depends
+     * only on the vector length.
+     *
+     * @param party The party object representing the current party.
+     * @param ct The correlated randomness of the party (see GetSortCount).
+     * @param x_vec The vector of secret-shared values in [0, 2^(bitsize - 1)).
+     * @param z_vec The vector to store the secret-shared sorted values.
+     */
+    void Sort(Party &party, const ComparisonTriples &ct, const std::vector<uint32_t> &x_vec, std::vector<uint32_t> &z_vec) const;
+
+private:
+    const uint32_t              bitsize_; /**< Bit size of the arithmetic ring. */
+    const ShareConversion       conv_;    /**< Share conversion for the comparison bits. */
+    const AdditiveSecretSharing ass_;     /**< Additive secret sharing for the selections. */
+
+    /**
+     * @brief Reduces the values (and optionally their indices) with a tournament tree.
+     */
+    void Tournament(Party &party, const ComparisonTriples &ct, const std::vector<uint32_t> &x_vec, const bool with_index, uint32_t &max, uint32_t &index) const;
+
+    /**
+     * @brief Compares views of secret-shared values; the number of comparisons is the size of 'lt_vec'.
+     */
+    void LessThan(Party &party, utils::Span<const BeaverTriplet> btp_vec, utils::Span<const DaBit> dabit_vec, utils::Span<const uint32_t> x_vec, utils::Span<const uint32_t> y_vec, utils::Span<uint32_t> lt_vec) const;
+};
+
+}    // namespace secret_sharing
+}    // namespace tools
+
+#endif    // COMPARISON_H_
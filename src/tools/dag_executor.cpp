@@ -0,0 +1,650 @@
+#include "dag_executor.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <queue>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include "../utils/utils.hpp"
+
+namespace {
+
+/**
+ * @brief Minimal JSON value used to parse function graphs.
+ *
+ * Numbers are kept as their literal string, matching how compiler.py treats parameters.
+ */
+struct JsonValue {
+    enum class Type {
+        kNull,
+        kString,
+        kNumber,
+        kBool,
+        kArray,
+        kObject,
+    };
+
+    Type                                           type = Type::kNull;
+    std::string                                    str;
+    std::vector<JsonValue>                         arr;
+    std::vector<std::pair<std::string, JsonValue>> obj;
+
+    const JsonValue *Find(const std::string &key) const {
+        for (const auto &kv : obj) {
+            if (kv.first == key) {
+                return &kv.second;
+            }
+        }
+        return nullptr;
+    }
+};
+
+class JsonParser {
+public:
+    explicit JsonParser(const std::string &str)
+        : str_(str), pos_(0) {
+    }
+
+    JsonValue Parse() {
+        JsonValue value = ParseValue();
+        SkipSpaces();
+        if (pos_ != str_.size()) {
+            throw std::invalid_argument("Unexpected trailing characters in JSON at position " + std::to_string(pos_));
+        }
+        return value;
+    }
+
+private:
+    const std::string &str_;
+    size_t             pos_;
+
+    void SkipSpaces() {
+        while (pos_ < str_.size() && std::isspace(static_cast<unsigned char>(str_[pos_]))) {
+            pos_++;
+        }
+    }
+
+    void Expect(const char c) {
+        SkipSpaces();
+        if (pos_ >= str_.size() || str_[pos_] != c) {
+            throw std::invalid_argument(std::string("Expected '") + c + "' in JSON at position " + std::to_string(pos_));
+        }
+        pos_++;
+    }
+
+    bool Consume(const char c) {
+        SkipSpaces();
+        if (pos_ < str_.size() && str_[pos_] == c) {
+            pos_++;
+            return true;
+        }
+        return false;
+    }
+
+    std::string ParseString() {
+        Expect('"');
+        std::string out;
+        while (pos_ < str_.size() && str_[pos_] != '"') {
+            if (str_[pos_] != '\\') {
+                out.push_back(str_[pos_++]);
+                continue;
+            }
+            if (++pos_ >= str_.size()) {
+                break;
+            }
+            const char esc = str_[pos_++];
+            switch (esc) {
+                case '"':
+                case '\\':
+                case '/':
+                    out.push_back(esc);
+                    break;
+                case 'b':
+                    out.push_back('\b');
+                    break;
+                case 'f':
+                    out.push_back('\f');
+                    break;
+                case 'n':
+                    out.push_back('\n');
+                    break;
+                case 'r':
+                    out.push_back('\r');
+                    break;
+                case 't':
+                    out.push_back('\t');
+                    break;
+                case 'u':
+                    AppendUtf8(ParseCodePoint(), out);
+                    break;
+                default:
+                    throw std::invalid_argument(std::string("Invalid escape '\\") + esc + "' in JSON at position " + std::to_string(pos_ - 2));
+            }
+        }
+        Expect('"');
+        return out;
+    }
+
+    uint32_t ParseHex4() {
+        if (pos_ + 4 > str_.size()) {
+            throw std::invalid_argument("Truncated \\u escape in JSON at position " + std::to_string(pos_));
+        }
+        uint32_t code = 0;
+        for (size_t i = 0; i < 4; i++) {
+            const char c = str_[pos_++];
+            if (!std::isxdigit(static_cast<unsigned char>(c))) {
+                throw std::invalid_argument("Invalid \\u escape in JSON at position " + std::to_string(pos_ - 1));
+            }
+            code = (code << 4) | static_cast<uint32_t>(std::isdigit(static_cast<unsigned char>(c)) ? c - '0' : std::tolower(static_cast<unsigned char>(c)) - 'a' + 10);
+        }
+        return code;
+    }
+
+    // Reads the four hex digits of a "u" escape, combining a UTF-16 surrogate pair into one code point
+    uint32_t ParseCodePoint() {
+        uint32_t code = ParseHex4();
+        if (code >= 0xDC00 && code <= 0xDFFF) {
+            throw std::invalid_argument("Unpaired low surrogate in JSON at position " + std::to_string(pos_ - 6));
+        }
+        if (code >= 0xD800 && code <= 0xDBFF) {
+            if (pos_ + 2 > str_.size() || str_[pos_] != '\\' || str_[pos_ + 1] != 'u') {
+                throw std::invalid_argument("Unpaired high surrogate in JSON at position " + std::to_string(pos_ - 6));
+            }
+            pos_ += 2;
+            uint32_t low = ParseHex4();
+            if (low < 0xDC00 || low > 0xDFFF) {
+                throw std::invalid_argument("Invalid low surrogate in JSON at position " + std::to_string(pos_ - 6));
+            }
+            code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+        }
+        return code;
+    }
+
+    static void AppendUtf8(const uint32_t code, std::string &out) {
+        if (code < 0x80) {
+            out.push_back(static_cast<char>(code));
+        } else if (code < 0x800) {
+            out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        } else if (code < 0x10000) {
+            out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        } else {
+            out.push_back(static_cast<char>(0xF0 | (code >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        }
+    }
+
+    JsonValue ParseValue() {
+        SkipSpaces();
+        if (pos_ >= str_.size()) {
+            throw std::invalid_argument("Unexpected end of JSON");
+        }
+        JsonValue value;
+        const char c = str_[pos_];
+        if (c == '{') {
+            value.type = JsonValue::Type::kObject;
+            pos_++;
+            if (!Consume('}')) {
+                do {
+                    std::string key = ParseString();
+                    Expect(':');
+                    value.obj.emplace_back(key, ParseValue());
+                } while (Consume(','));
+                Expect('}');
+            }
+        } else if (c == '[') {
+            value.type = JsonValue::Type::kArray;
+            pos_++;
+            if (!Consume(']')) {
+                do {
+                    value.arr.push_back(ParseValue());
+                } while (Consume(','));
+                Expect(']');
+            }
+        } else if (c == '"') {
+            value.type = JsonValue::Type::kString;
+            value.str  = ParseString();
+        } else {
+            // Numbers, true, false and null are kept as literals
+            size_t start = pos_;
+            while (pos_ < str_.size() && (std::isalnum(static_cast<unsigned char>(str_[pos_])) || str_[pos_] == '-' || str_[pos_] == '+' || str_[pos_] == '.')) {
+                pos_++;
+            }
+            value.str = str_.substr(start, pos_ - start);
+            if (value.str.empty()) {
+                throw std::invalid_argument("Invalid JSON value at position " + std::to_string(start));
+            }
+            if (value.str == "null") {
+                value.type = JsonValue::Type::kNull;
+            } else if (value.str == "true" || value.str == "false") {
+                value.type = JsonValue::Type::kBool;
+            } else {
+                value.type = JsonValue::Type::kNumber;
+            }
+        }
+        return value;
+    }
+};
+
+bool IsNumeric(const std::string &str) {
+    if (str.empty()) {
+        return false;
+    }
+    size_t start = (str[0] == '-' || str[0] == '+') ? 1 : 0;
+    if (start == str.size()) {
+        return false;
+    }
+    return std::all_of(str.begin() + start, str.end(), [](unsigned char c) { return std::isdigit(c); });
+}
+
+// compiler.py accepts every literal that float() parses, so such parameters must not be taken for input names
+bool IsFloatLiteral(const std::string &str) {
+    if (str.empty() || std::isspace(static_cast<unsigned char>(str[0]))) {
+        return false;
+    }
+    char *end = nullptr;
+    std::strtod(str.c_str(), &end);
+    return end == str.c_str() + str.size();
+}
+
+// Constants are 32-bit ring elements, so literals must lie in [-2^31, 2^32 - 1]
+uint32_t ParseConstant(const std::string &literal, const std::string &function) {
+    const std::string error = "Constant " + literal + " of function '" + function + "' does not fit in 32 bits.";
+    int64_t           value = 0;
+    try {
+        value = std::stoll(literal);
+    } catch (const std::out_of_range &) {
+        throw std::invalid_argument(error);
+    }
+    if (value < -(int64_t(1) << 31) || value > (int64_t(1) << 32) - 1) {
+        throw std::invalid_argument(error);
+    }
+    return static_cast<uint32_t>(value);
+}
+
+tools::executor::OpType ParseOpType(const std::string &function) {
+    using tools::executor::OpType;
+    static const std::unordered_map<std::string, OpType> op_map = {
+        {"add", OpType::kAdd},
+        {"sub", OpType::kSub},
+        {"mult", OpType::kMult},
+        {"xor", OpType::kXor},
+        {"and", OpType::kAnd},
+        {"or", OpType::kOr},
+    };
+    auto it = op_map.find(function);
+    if (it == op_map.end()) {
+        throw std::invalid_argument("Unsupported function: " + function);
+    }
+    return it->second;
+}
+
+uint32_t FoldConstant(const tools::executor::OpType op, const uint32_t x, const uint32_t y) {
+    using tools::executor::OpType;
+    switch (op) {
+        case OpType::kAdd:
+            return x + y;
+        case OpType::kSub:
+            return x - y;
+        case OpType::kMult:
+            return x * y;
+        case OpType::kXor:
+            return x ^ y;
+        case OpType::kAnd:
+            return x & y;
+        case OpType::kOr:
+            return x | y;
+    }
+    return 0;
+}
+
+}    // namespace
+
+namespace tools {
+namespace executor {
+
+bool FunctionNode::IsNonlinear() const {
+    return !this->is_constant && (this->op == OpType::kMult || this->op == OpType::kAnd || this->op == OpType::kOr) &&
+           this->operands[0].kind != Operand::Kind::kConstant && this->operands[1].kind != Operand::Kind::kConstant;
+}
+
+bool FunctionNode::IsBoolean() const {
+    return this->op == OpType::kXor || this->op == OpType::kAnd || this->op == OpType::kOr;
+}
+
+FunctionGraph FunctionGraph::FromJson(const std::string &json_str) {
+    JsonValue        root      = JsonParser(json_str).Parse();
+    const JsonValue *functions = root.Find("functions");
+    if (functions == nullptr || functions->type != JsonValue::Type::kArray) {
+        throw std::invalid_argument("The JSON object must contain a \"functions\" array.");
+    }
+
+    FunctionGraph graph;
+    for (const JsonValue &func : functions->arr) {
+        const JsonValue *name   = func.Find("name");
+        const JsonValue *fn     = func.Find("function");
+        const JsonValue *params = func.Find("parameters");
+        if (name == nullptr || fn == nullptr || params == nullptr || params->type != JsonValue::Type::kObject) {
+            throw std::invalid_argument("Each function must have \"name\", \"function\" and \"parameters\".");
+        }
+        // Parameters are taken in sorted key order, as in compiler.py
+        std::map<std::string, std::string> sorted_params;
+        for (const auto &kv : params->obj) {
+            if (kv.second.type == JsonValue::Type::kObject || kv.second.type == JsonValue::Type::kArray) {
+                throw std::invalid_argument("Parameter '" + kv.first + "' of function '" + name->str + "' must be a string or a number.");
+            }
+            sorted_params[kv.first] = kv.second.str;
+        }
+        std::vector<std::string> param_vec;
+        for (const auto &kv : sorted_params) {
+            param_vec.push_back(kv.second);
+        }
+        graph.AddFunction(name->str, fn->str, param_vec);
+    }
+    graph.Levelize();
+    return graph;
+}
+
+void FunctionGraph::AddFunction(const std::string &name, const std::string &function, const std::vector<std::string> &params) {
+    if (params.size() != 2) {
+        throw std::invalid_argument("Function '" + name + "' must have exactly two parameters.");
+    }
+    FunctionNode node;
+    node.name           = name;
+    node.op             = ParseOpType(function);
+    node.level          = 0;
+    node.is_constant    = false;
+    node.constant_value = 0;
+    this->nodes_.push_back(node);
+    this->params_.push_back({params[0], params[1]});
+}
+
+void FunctionGraph::Levelize() {
+    size_t                                    num_nodes = this->nodes_.size();
+    std::unordered_map<std::string, uint32_t> name_to_index;
+    for (size_t i = 0; i < num_nodes; i++) {
+        if (!name_to_index.emplace(this->nodes_[i].name, i).second) {
+            throw std::invalid_argument("Duplicate function name: " + this->nodes_[i].name);
+        }
+    }
+
+    // Resolve operands and build the dependency lists
+    this->input_names_.clear();
+    std::vector<std::vector<uint32_t>> dependents(num_nodes);
+    std::vector<uint32_t>              in_degree(num_nodes, 0);
+    for (size_t i = 0; i < num_nodes; i++) {
+        for (size_t j = 0; j < 2; j++) {
+            const std::string &param   = this->params_[i][j];
+            Operand           &operand = this->nodes_[i].operands[j];
+            operand.name               = param;
+            operand.index              = 0;
+            operand.value              = 0;
+            auto it                    = name_to_index.find(param);
+            if (it != name_to_index.end()) {
+                operand.kind  = Operand::Kind::kNode;
+                operand.index = it->second;
+                dependents[it->second].push_back(i);
+                in_degree[i]++;
+            } else if (IsNumeric(param)) {
+                operand.kind  = Operand::Kind::kConstant;
+                operand.value = ParseConstant(param, this->nodes_[i].name);
+            } else if (IsFloatLiteral(param)) {
+                throw std::invalid_argument("Only integer constants are supported: " + param);
+            } else {
+                operand.kind = Operand::Kind::kInput;
+                if (std::find(this->input_names_.begin(), this->input_names_.end(), param) == this->input_names_.end()) {
+                    this->input_names_.push_back(param);
+                }
+            }
+        }
+    }
+
+    // Topological sort (Kahn's algorithm), keeping insertion order among ready nodes
+    std::vector<uint32_t> order;
+    order.reserve(num_nodes);
+    std::queue<uint32_t> ready;
+    for (size_t i = 0; i < num_nodes; i++) {
+        if (in_degree[i] == 0) {
+            ready.push(i);
+        }
+    }
+    while (!ready.empty()) {
+        uint32_t idx = ready.front();
+        ready.pop();
+        order.push_back(idx);
+        for (uint32_t dep : dependents[idx]) {
+            if (--in_degree[dep] == 0) {
+                ready.push(dep);
+            }
+        }
+    }
+    if (order.size() != num_nodes) {
+        throw std::invalid_argument("The function graph contains a cycle.");
+    }
+
+    // Fold constants and compute the multiplicative depth of each node
+    uint32_t max_level = 0;
+    for (uint32_t idx : order) {
+        FunctionNode &node  = this->nodes_[idx];
+        uint32_t      level = 0;
+        for (Operand &operand : node.operands) {
+            if (operand.kind == Operand::Kind::kNode) {
+                const FunctionNode &src = this->nodes_[operand.index];
+                if (src.is_constant) {
+                    operand.kind  = Operand::Kind::kConstant;
+                    operand.value = src.constant_value;
+                } else {
+                    if (src.IsBoolean() != node.IsBoolean()) {
+                        throw std::invalid_argument("Function '" + node.name + "' mixes arithmetic and Boolean operands.");
+                    }
+                    level = std::max(level, src.level);
+                }
+            }
+        }
+        node.is_constant = node.operands[0].kind == Operand::Kind::kConstant && node.operands[1].kind == Operand::Kind::kConstant;
+        if (node.is_constant) {
+            node.constant_value = FoldConstant(node.op, node.operands[0].value, node.operands[1].value);
+        }
+        node.level = node.IsNonlinear() ? level + 1 : level;
+        max_level  = std::max(max_level, node.level);
+    }
+
+    // Group the nodes into layers
+    this->layers_.assign(max_level + 1, GraphLayer());
+    for (uint32_t idx : order) {
+        const FunctionNode &node = this->nodes_[idx];
+        if (node.is_constant) {
+            continue;
+        }
+        GraphLayer &layer = this->layers_[node.level];
+        if (node.IsNonlinear()) {
+            if (node.IsBoolean()) {
+                layer.bool_and_nodes.push_back(idx);
+            } else {
+                layer.arith_mult_nodes.push_back(idx);
+            }
+        } else {
+            layer.linear_nodes.push_back(idx);
+        }
+    }
+}
+
+const std::vector<FunctionNode> &FunctionGraph::GetNodes() const {
+    return this->nodes_;
+}
+
+const std::vector<GraphLayer> &FunctionGraph::GetLayers() const {
+    return this->layers_;
+}
+
+const std::vector<std::string> &FunctionGraph::GetInputNames() const {
+    return this->input_names_;
+}
+
+uint32_t FunctionGraph::GetNumArithmeticTriples() const {
+    uint32_t num = 0;
+    for (const GraphLayer &layer : this->layers_) {
+        num += layer.arith_mult_nodes.size();
+    }
+    return num;
+}
+
+uint32_t FunctionGraph::GetNumBooleanTriples() const {
+    uint32_t num = 0;
+    for (const GraphLayer &layer : this->layers_) {
+        num += layer.bool_and_nodes.size();
+    }
+    return num;
+}
+
+uint32_t FunctionGraph::GetNumRounds() const {
+    uint32_t rounds = 0;
+    for (const GraphLayer &layer : this->layers_) {
+        rounds += (layer.arith_mult_nodes.empty() && layer.bool_and_nodes.empty()) ? 0 : 1;
+    }
+    return rounds;
+}
+
+DagExecutor::DagExecutor(secret_sharing::Party &party, const FunctionGraph &graph, const uint32_t bitsize)
+    : party_(party), graph_(graph), bitsize_(bitsize) {
+}
+
+std::map<std::string, uint32_t> DagExecutor::Run(const std::map<std::string, uint32_t> &inputs, const secret_sharing::bts_t &bt_vec, const secret_sharing::bts_t &btb_vec) {
+    if (bt_vec.size() < this->graph_.GetNumArithmeticTriples() || btb_vec.size() < this->graph_.GetNumBooleanTriples()) {
+        throw std::invalid_argument("Not enough Beaver triples to evaluate the function graph.");
+    }
+    size_t bt_idx = 0, btb_idx = 0;
+    return this->RunLayers(
+        inputs,
+        [&bt_vec, &bt_idx](const uint32_t num, secret_sharing::bts_t &bts) {
+            bts.assign(bt_vec.begin() + bt_idx, bt_vec.begin() + bt_idx + num);
+            bt_idx += num;
+        },
+        [&btb_vec, &btb_idx](const uint32_t num, secret_sharing::bts_t &bts) {
+            bts.assign(btb_vec.begin() + btb_idx, btb_vec.begin() + btb_idx + num);
+            btb_idx += num;
+        });
+}
+
+std::map<std::string, uint32_t> DagExecutor::Run(const std::map<std::string, uint32_t> &inputs, secret_sharing::TriplePool &bt_pool, secret_sharing::TriplePool &btb_pool) {
+    return this->RunLayers(
+        inputs,
+        [&bt_pool](const uint32_t num, secret_sharing::bts_t &bts) { bt_pool.Draw(num, bts); },
+        [&btb_pool](const uint32_t num, secret_sharing::bts_t &bts) { btb_pool.Draw(num, bts); });
+}
+
+std::map<std::string, uint32_t> DagExecutor::RunLayers(const std::map<std::string, uint32_t> &inputs, const triple_fetcher_t &fetch_bt, const triple_fetcher_t &fetch_btb) {
+    const std::vector<FunctionNode> &nodes = this->graph_.GetNodes();
+    for (const std::string &name : this->graph_.GetInputNames()) {
+        if (inputs.find(name) == inputs.end()) {
+            throw std::invalid_argument("Missing input share: " + name);
+        }
+    }
+
+    std::vector<uint32_t>      values(nodes.size(), 0);
+    secret_sharing::bts_t      bts, btbs;
+    secret_sharing::MultBatch batch(this->bitsize_);
+    for (const GraphLayer &layer : this->graph_.GetLayers()) {
+        // Evaluate all arithmetic multiplications and Boolean AND/OR gates of this layer in one round
+        size_t                num_mult = layer.arith_mult_nodes.size();
+        size_t                num_and  = layer.bool_and_nodes.size();
+        std::vector<uint32_t> x_vec(num_mult), y_vec(num_mult), z_vec(num_mult);
+        std::vector<uint32_t> xb_vec(num_and), yb_vec(num_and), zb_vec(num_and);
+        // x | y = !(!x & !y); the negation is applied by party 0 only
+        const uint32_t negate = (this->party_.GetId() == 0) ? 1 : 0;
+        batch.Clear();
+        if (num_mult > 0) {
+            fetch_bt(num_mult, bts);
+            for (size_t i = 0; i < num_mult; i++) {
+                const FunctionNode &node = nodes[layer.arith_mult_nodes[i]];
+                x_vec[i]                 = this->GetOperandShare(node.operands[0], values, inputs);
+                y_vec[i]                 = this->GetOperandShare(node.operands[1], values, inputs);
+            }
+            batch.AddMult(bts, x_vec, y_vec, z_vec);
+        }
+        if (num_and > 0) {
+            fetch_btb(num_and, btbs);
+            for (size_t i = 0; i < num_and; i++) {
+                const FunctionNode &node = nodes[layer.bool_and_nodes[i]];
+                const uint32_t      flip = (node.op == OpType::kOr) ? negate : 0;
+                xb_vec[i]                = this->GetOperandShare(node.operands[0], values, inputs) ^ flip;
+                yb_vec[i]                = this->GetOperandShare(node.operands[1], values, inputs) ^ flip;
+            }
+            batch.AddAnd(btbs, xb_vec, yb_vec, zb_vec);
+        }
+        if (batch.GetNumGroups() > 0) {
+            batch.Run(this->party_);
+        }
+        for (size_t i = 0; i < num_mult; i++) {
+            values[layer.arith_mult_nodes[i]] = z_vec[i];
+        }
+        for (size_t i = 0; i < num_and; i++) {
+            const FunctionNode &node          = nodes[layer.bool_and_nodes[i]];
+            values[layer.bool_and_nodes[i]] = zb_vec[i] ^ ((node.op == OpType::kOr) ? negate : 0);
+        }
+
+        // Evaluate the linear functions that depend on this layer locally
+        for (uint32_t idx : layer.linear_nodes) {
+            values[idx] = this->EvaluateLinear(nodes[idx], values, inputs);
+        }
+    }
+
+    std::map<std::string, uint32_t> outputs;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        if (nodes[i].is_constant) {
+            outputs[nodes[i].name] = (this->party_.GetId() == 0) ? nodes[i].constant_value : 0;
+        } else {
+            outputs[nodes[i].name] = values[i];
+        }
+    }
+    return outputs;
+}
+
+uint32_t DagExecutor::GetOperandShare(const Operand &operand, const std::vector<uint32_t> &values, const std::map<std::string, uint32_t> &inputs) const {
+    switch (operand.kind) {
+        case Operand::Kind::kNode:
+            return values[operand.index];
+        case Operand::Kind::kInput:
+            return inputs.at(operand.name);
+        case Operand::Kind::kConstant:
+            // A public constant is shared as (c, 0)
+            return (this->party_.GetId() == 0) ? operand.value : 0;
+    }
+    return 0;
+}
+
+uint32_t DagExecutor::EvaluateLinear(const FunctionNode &node, const std::vector<uint32_t> &values, const std::map<std::string, uint32_t> &inputs) const {
+    const Operand &lhs   = node.operands[0];
+    const Operand &rhs   = node.operands[1];
+    uint32_t       x     = this->GetOperandShare(lhs, values, inputs);
+    uint32_t       y     = this->GetOperandShare(rhs, values, inputs);
+    // Raw value of the public operand for multiplicative operations by a constant
+    uint32_t       c     = (lhs.kind == Operand::Kind::kConstant) ? lhs.value : rhs.value;
+    uint32_t       share = (lhs.kind == Operand::Kind::kConstant) ? y : x;
+    switch (node.op) {
+        case OpType::kAdd:
+            return utils::Mod(x + y, this->bitsize_);
+        case OpType::kSub:
+            return utils::Mod(x - y, this->bitsize_);
+        case OpType::kMult:
+            return utils::Mod(share * c, this->bitsize_);
+        case OpType::kXor:
+            return x ^ y;
+        case OpType::kAnd:
+            return share & c;
+        case OpType::kOr:
+            // x | c = (x & ~c) ^ c, where c is added by party 0 only
+            return (share & ~c) ^ ((this->party_.GetId() == 0) ? c : 0);
+    }
+    return 0;
+}
+
+}    // namespace executor
+}    // namespace tools
@@ -0,0 +1,217 @@
+#ifndef DAG_EXECUTOR_H_
+#define DAG_EXECUTOR_H_
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "secret_sharing.hpp"
+#include "triple_pool.hpp"
+
+namespace tools {
+namespace executor {
+
+/**
+ * @brief Operations supported in a function graph.
+ *
+ * Arithmetic operations (add, sub, mult) run over AdditiveSecretSharing and
+ * Boolean operations (xor, and, or) run over BooleanSecretSharing.
+ */
+enum class OpType {
+    kAdd,
+    kSub,
+    kMult,
+    kXor,
+    kAnd,
+    kOr,
+};
+
+/**
+ * @brief Reference to an operand of a function node.
+ *
+ * An operand is either the output of another node, an external input share, or a public constant.
+ */
+struct Operand {
+    enum class Kind {
+        kNode,
+        kInput,
+        kConstant,
+    };
+
+    Kind        kind;  /**< Kind of the operand. */
+    uint32_t    index; /**< Index of the referenced node (kNode only). */
+    uint32_t    value; /**< Value of the public constant (kConstant only). */
+    std::string name;  /**< Name of the referenced node or input. */
+};
+
+/**
+ * @brief A single function (gate) of a function graph.
+ */
+struct FunctionNode {
+    std::string            name;           /**< Name of the function (output variable). */
+    OpType                 op;             /**< Operation performed by the function. */
+    std::array<Operand, 2> operands;       /**< Operands of the function. */
+    uint32_t               level;          /**< Multiplicative depth at which the output is available. */
+    bool                   is_constant;    /**< True if all operands are public and the output was folded. */
+    uint32_t               constant_value; /**< Folded output value (is_constant only). */
+
+    /**
+     * @brief Checks whether the function needs an interactive multiplication.
+     *
+     * @return True if the function is a mult/and/or over two secret-shared operands.
+     */
+    bool IsNonlinear() const;
+
+    /**
+     * @brief Checks whether the function operates on Boolean shares.
+     *
+     * @return True if the function is a xor/and/or operation.
+     */
+    bool IsBoolean() const;
+};
+
+/**
+ * @brief Layers of a levelized function graph.
+ *
+ * Each layer holds the nonlinear nodes that are evaluated together in one batched round,
+ * followed by the linear nodes that become computable afterwards (in topological order).
+ */
+struct GraphLayer {
+    std::vector<uint32_t> arith_mult_nodes; /**< Arithmetic multiplications of the batched round. */
+    std::vector<uint32_t> bool_and_nodes;   /**< Boolean AND/OR gates of the batched round. */
+    std::vector<uint32_t> linear_nodes;     /**< Nodes evaluated locally after the batched round. */
+};
+
+class FunctionGraph {
+public:
+    /**
+     * @brief Parses a function graph from the JSON format used by compiler.py.
+     *
+     * The JSON object holds a "functions" array. Each function has a "name", a "function"
+     * (add, sub, mult, xor, and, or) and a "parameters" object whose values are taken in
+     * sorted key order. A parameter is either the name of another function, a numeric
+     * literal, or the name of an external input.
+     *
+     * @param json_str The JSON string describing the function graph.
+     * @return The parsed and levelized function graph.
+     */
+    static FunctionGraph FromJson(const std::string &json_str);
+
+    /**
+     * @brief Adds a function to the graph.
+     *
+     * Functions may be added in any order; dependencies are resolved by Levelize().
+     *
+     * @param name The name of the function (output variable).
+     * @param function The name of the operation (add, sub, mult, xor, and, or).
+     * @param params The two parameters of the function.
+     */
+    void AddFunction(const std::string &name, const std::string &function, const std::vector<std::string> &params);
+
+    /**
+     * @brief Resolves operands, folds constants and computes the topological depth levels.
+     *
+     * The level of a node is the maximum level of its operands, plus one if the node is
+     * nonlinear. Hence the number of layers equals the multiplicative depth of the graph.
+     */
+    void Levelize();
+
+    const std::vector<FunctionNode> &GetNodes() const;
+    const std::vector<GraphLayer>   &GetLayers() const;
+    const std::vector<std::string>  &GetInputNames() const;
+
+    /**
+     * @brief Gets the number of arithmetic Beaver triples consumed by one evaluation.
+     */
+    uint32_t GetNumArithmeticTriples() const;
+
+    /**
+     * @brief Gets the number of Boolean Beaver triples consumed by one evaluation.
+     */
+    uint32_t GetNumBooleanTriples() const;
+
+    /**
+     * @brief Gets the number of communication rounds of one evaluation.
+     *
+     * Every layer with nonlinear nodes takes one round, even if it mixes arithmetic and Boolean nodes.
+     */
+    uint32_t GetNumRounds() const;
+
+private:
+    std::vector<FunctionNode>               nodes_;       /**< Nodes in insertion order. */
+    std::vector<std::array<std::string, 2>> params_;      /**< Raw parameters of each node. */
+    std::vector<GraphLayer>                 layers_;      /**< Layers computed by Levelize(). */
+    std::vector<std::string>                input_names_; /**< Names of the external inputs. */
+};
+
+class DagExecutor {
+public:
+    /**
+     * @brief Constructs a DagExecutor for a levelized function graph.
+     *
+     * @param party The party that evaluates the graph.
+     * @param graph The levelized function graph.
+     * @param bitsize The bit size of the arithmetic ring.
+     */
+    DagExecutor(secret_sharing::Party &party, const FunctionGraph &graph, const uint32_t bitsize = 32);
+
+    /**
+     * @brief Evaluates the function graph layer by layer.
+     *
+     * All nonlinear nodes of a layer, arithmetic and Boolean, are evaluated by a single
+     * MultBatch, so the number of rounds equals the multiplicative depth of the graph rather
+     * than its operation count.
+     *
+     * @param inputs The shares of the external inputs, keyed by name.
+     * @param bt_vec The arithmetic Beaver triple shares (at least GetNumArithmeticTriples()).
+     * @param btb_vec The Boolean Beaver triple shares (at least GetNumBooleanTriples()).
+     * @return The output shares of every function, keyed by name.
+     */
+    std::map<std::string, uint32_t> Run(const std::map<std::string, uint32_t> &inputs, const secret_sharing::bts_t &bt_vec, const secret_sharing::bts_t &btb_vec);
+
+    /**
+     * @brief Evaluates the function graph layer by layer, drawing triples from triple pools.
+     *
+     * Each layer draws exactly the triples it needs, so triple loading overlaps with the
+     * online phase instead of preceding it.
+     *
+     * @param inputs The shares of the external inputs, keyed by name.
+     * @param bt_pool The pool of arithmetic Beaver triple shares.
+     * @param btb_pool The pool of Boolean Beaver triple shares.
+     * @return The output shares of every function, keyed by name.
+     */
+    std::map<std::string, uint32_t> Run(const std::map<std::string, uint32_t> &inputs, secret_sharing::TriplePool &bt_pool, secret_sharing::TriplePool &btb_pool);
+
+private:
+    /**
+     * @brief Function that fetches the next 'num' triples into 'bt_vec'.
+     */
+    using triple_fetcher_t = std::function<void(const uint32_t num, secret_sharing::bts_t &bt_vec)>;
+
+    secret_sharing::Party &party_;   /**< Party evaluating the graph. */
+    const FunctionGraph   &graph_;   /**< Function graph to evaluate. */
+    const uint32_t         bitsize_; /**< Bit size of the arithmetic ring. */
+
+    /**
+     * @brief Evaluates the function graph with the given triple fetchers.
+     */
+    std::map<std::string, uint32_t> RunLayers(const std::map<std::string, uint32_t> &inputs, const triple_fetcher_t &fetch_bt, const triple_fetcher_t &fetch_btb);
+
+    /**
+     * @brief Gets the share (or party-adjusted public value) of an operand.
+     */
+    uint32_t GetOperandShare(const Operand &operand, const std::vector<uint32_t> &values, const std::map<std::string, uint32_t> &inputs) const;
+
+    /**
+     * @brief Evaluates a linear node locally.
+     */
+    uint32_t EvaluateLinear(const FunctionNode &node, const std::vector<uint32_t> &values, const std::map<std::string, uint32_t> &inputs) const;
+};
+
+}    // namespace executor
+}    // namespace tools
+
+#endif    // DAG_EXECUTOR_H_
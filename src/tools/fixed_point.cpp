@@ -0,0 +1,168 @@
+#include "fixed_point.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+#include "../utils/utils.hpp"
+
+namespace tools {
+namespace secret_sharing {
+
+FixedPointSecretSharing::FixedPointSecretSharing(const uint32_t frac_bits, const uint32_t bitsize)
+    : frac_bits_(frac_bits), bitsize_(bitsize), ss_(bitsize) {
+    if (bitsize < 2 || bitsize > 32) {
+        throw std::invalid_argument("The bit size must be between 2 and 32.");
+    }
+    if (frac_bits == 0 || frac_bits >= bitsize - 1) {
+        throw std::invalid_argument("The number of fractional bits must be between 1 and bitsize - 2.");
+    }
+}
+
+uint32_t FixedPointSecretSharing::GetFracBits() const {
+    return this->frac_bits_;
+}
+
+uint32_t FixedPointSecretSharing::Encode(const double x) const {
+    int64_t scaled = static_cast<int64_t>(std::llround(std::ldexp(x, static_cast<int>(this->frac_bits_))));
+    return utils::Mod(static_cast<uint32_t>(scaled), this->bitsize_);
+}
+
+std::vector<uint32_t> FixedPointSecretSharing::Encode(const std::vector<double> &x_vec) const {
+    std::vector<uint32_t> enc_vec(x_vec.size());
+    for (size_t i = 0; i < x_vec.size(); i++) {
+        enc_vec[i] = this->Encode(x_vec[i]);
+    }
+    return enc_vec;
+}
+
+double FixedPointSecretSharing::Decode(const uint32_t x) const {
+    // Interpret the ring element as a two's complement integer of 'bitsize_' bits
+    int64_t value = static_cast<int64_t>(utils::Mod(x, this->bitsize_));
+    if (value >= (int64_t(1) << (this->bitsize_ - 1))) {
+        value -= int64_t(1) << this->bitsize_;
+    }
+    return std::ldexp(static_cast<double>(value), -static_cast<int>(this->frac_bits_));
+}
+
+std::vector<double> FixedPointSecretSharing::Decode(const std::vector<uint32_t> &x_vec) const {
+    std::vector<double> dec_vec(x_vec.size());
+    for (size_t i = 0; i < x_vec.size(); i++) {
+        dec_vec[i] = this->Decode(x_vec[i]);
+    }
+    return dec_vec;
+}
+
+uint32_t FixedPointSecretSharing::Truncate(const Party &party, const uint32_t x) const {
+    // Party 0 shifts its share, and party 1 shifts the negation of its share: x_0 >> f and -((-x_1) >> f)
+    if (party.GetId() == 0) {
+        return utils::Mod(x, this->bitsize_) >> this->frac_bits_;
+    } else {
+        return utils::Mod(0U - (utils::Mod(0U - x, this->bitsize_) >> this->frac_bits_), this->bitsize_);
+    }
+}
+
+void FixedPointSecretSharing::Truncate(const Party &party, std::vector<uint32_t> &x_vec) const {
+    if (party.GetId() == 0) {
+        for (size_t i = 0; i < x_vec.size(); i++) {
+            x_vec[i] = utils::Mod(x_vec[i], this->bitsize_) >> this->frac_bits_;
+        }
+    } else {
+        for (size_t i = 0; i < x_vec.size(); i++) {
+            x_vec[i] = utils::Mod(0U - (utils::Mod(0U - x_vec[i], this->bitsize_) >> this->frac_bits_), this->bitsize_);
+        }
+    }
+}
+
+void FixedPointSecretSharing::GenerateTruncPairs(const uint32_t num, truncs_t &tp_vec) const {
+    tp_vec.resize(num);
+    for (uint32_t i = 0; i < num; i++) {
+        uint32_t r = utils::Mod(rng::SecureRng::Rand64(), this->bitsize_);
+        tp_vec[i]  = TruncPair{r, utils::Mod(r, this->bitsize_ - 1) >> this->frac_bits_, r >> (this->bitsize_ - 1)};
+    }
+}
+
+std::pair<truncs_t, truncs_t> FixedPointSecretSharing::ShareTruncPairs(const truncs_t &tp_vec) const {
+    truncs_t tp_vec_0(tp_vec.size());
+    truncs_t tp_vec_1(tp_vec.size());
+    for (size_t i = 0; i < tp_vec.size(); i++) {
+        tp_vec_0[i].r       = utils::Mod(rng::SecureRng::Rand64(), this->bitsize_);
+        tp_vec_0[i].r_trunc = utils::Mod(rng::SecureRng::Rand64(), this->bitsize_);
+        tp_vec_0[i].r_msb   = utils::Mod(rng::SecureRng::Rand64(), this->bitsize_);
+        tp_vec_1[i].r       = utils::Mod(tp_vec[i].r - tp_vec_0[i].r, this->bitsize_);
+        tp_vec_1[i].r_trunc = utils::Mod(tp_vec[i].r_trunc - tp_vec_0[i].r_trunc, this->bitsize_);
+        tp_vec_1[i].r_msb   = utils::Mod(tp_vec[i].r_msb - tp_vec_0[i].r_msb, this->bitsize_);
+    }
+    return std::make_pair(tp_vec_0, tp_vec_1);
+}
+
+uint32_t FixedPointSecretSharing::Truncate(Party &party, const TruncPair &tp, const uint32_t x) const {
+    // Open c = u + r, where u = x + 2^(bitsize - 2) lies in [0, 2^(bitsize - 1)) and only party 0 adds the offset
+    const uint32_t offset = (party.GetId() == 0) ? (1U << (this->bitsize_ - 2)) : 0U;
+    uint32_t       c_own  = utils::Mod(x + offset + tp.r, this->bitsize_), c_other = 0;
+    party.Exchange(utils::Span<const uint32_t>(&c_own, 1), utils::Span<uint32_t>(&c_other, 1));
+    return this->TruncateOpened(party, tp, utils::Mod(c_own + c_other, this->bitsize_));
+}
+
+void FixedPointSecretSharing::Truncate(Party &party, const truncs_t &tp_vec, std::vector<uint32_t> &x_vec) const {
+    size_t num = x_vec.size();
+    if (tp_vec.size() < num) {
+        throw std::invalid_argument("Not enough truncation pairs for the shares.");
+    }
+    const uint32_t          offset = (party.GetId() == 0) ? (1U << (this->bitsize_ - 2)) : 0U;
+    utils::ThreadPool      &pool   = party.GetThreadPool();
+    utils::Workspace::Frame frame(party.GetWorkspace());
+    // Own masked values and those received from the other party
+    uint32_t *c_own   = party.GetWorkspace().Allocate(num);
+    uint32_t *c_other = party.GetWorkspace().Allocate(num);
+    pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            c_own[i] = utils::Mod(x_vec[i] + offset + tp_vec[i].r, this->bitsize_);
+        }
+    });
+    party.Exchange(utils::Span<const uint32_t>(c_own, num), utils::Span<uint32_t>(c_other, num));
+    pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            x_vec[i] = this->TruncateOpened(party, tp_vec[i], utils::Mod(c_own[i] + c_other[i], this->bitsize_));
+        }
+    });
+}
+
+uint32_t FixedPointSecretSharing::Mult(Party &party, const BeaverTriplet &bt, const uint32_t x, const uint32_t y) const {
+    return this->Truncate(party, this->ss_.Mult(party, bt, x, y));
+}
+
+void FixedPointSecretSharing::Mult(Party &party, const bts_t &bt_vec, const std::vector<uint32_t> &x_vec, const std::vector<uint32_t> &y_vec, std::vector<uint32_t> &z_vec) const {
+    z_vec.resize(x_vec.size());
+    this->ss_.Mult(party, bt_vec, x_vec, y_vec, z_vec);
+    this->Truncate(party, z_vec);
+}
+
+uint32_t FixedPointSecretSharing::Mult(Party &party, const BeaverTriplet &bt, const TruncPair &tp, const uint32_t x, const uint32_t y) const {
+    return this->Truncate(party, tp, this->ss_.Mult(party, bt, x, y));
+}
+
+void FixedPointSecretSharing::Mult(Party &party, const bts_t &bt_vec, const truncs_t &tp_vec, const std::vector<uint32_t> &x_vec, const std::vector<uint32_t> &y_vec, std::vector<uint32_t> &z_vec) const {
+    z_vec.resize(x_vec.size());
+    this->ss_.Mult(party, bt_vec, x_vec, y_vec, z_vec);
+    this->Truncate(party, tp_vec, z_vec);
+}
+
+uint32_t FixedPointSecretSharing::TruncateOpened(const Party &party, const TruncPair &tp, const uint32_t c) const {
+    // With r = 2^(bitsize - 1) * r_msb + r_lo and c = c_msb * 2^(bitsize - 1) + c_lo, the carry
+    // b = [u + r_lo >= 2^(bitsize - 1)] equals c_msb ^ r_msb, so u = c_lo - r_lo + b * 2^(bitsize - 1) and
+    // u >> f = (c_lo >> f) - (r_lo >> f) + b * 2^(bitsize - 1 - f), up to a carry of 1 in the last bit.
+    const uint32_t c_lo  = utils::Mod(c, this->bitsize_ - 1);
+    const uint32_t c_msb = c >> (this->bitsize_ - 1);
+    const uint32_t scale = 1U << (this->bitsize_ - 1 - this->frac_bits_);
+    // b = c_msb + r_msb - 2 * c_msb * r_msb, where only party 0 adds the public term c_msb
+    uint32_t b = tp.r_msb - 2 * c_msb * tp.r_msb;
+    uint32_t y = b * scale - tp.r_trunc;
+    if (party.GetId() == 0) {
+        // Add the public terms and remove the offset 2^(bitsize - 2) >> f
+        y += c_msb * scale + (c_lo >> this->frac_bits_) - (1U << (this->bitsize_ - 2 - this->frac_bits_));
+    }
+    return utils::Mod(y, this->bitsize_);
+}
+
+}    // namespace secret_sharing
+}    // namespace tools
@@ -0,0 +1,205 @@
+#ifndef FIXED_POINT_H_
+#define FIXED_POINT_H_
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "secret_sharing.hpp"
+
+namespace tools {
+namespace secret_sharing {
+
+/**
+ * @brief Dealer-generated mask for the interactive truncation (shares of one party or plain values).
+ */
+struct TruncPair {
+    uint32_t r;       /**< Additive share of the random mask 'r' over Z_{2^bitsize} (or 'r' itself). */
+    uint32_t r_trunc; /**< Additive share of (r mod 2^(bitsize - 1)) >> frac_bits (or the value itself). */
+    uint32_t r_msb;   /**< Additive share of the most significant bit of 'r' (or the bit itself). */
+};
+
+using truncs_t = std::vector<TruncPair>;
+
+/**
+ * @class FixedPointSecretSharing
+ * @brief Fixed-point arithmetic on additive shares over Z_{2^bitsize}.
+ *
+ * A real value x is encoded as the two's complement ring element round(x * 2^frac_bits).
+ * Products of two encodings carry 2 * frac_bits fractional bits and are rescaled by one of
+ * two truncations, both off by at most 1 in the last fractional bit when they succeed:
+ *
+ * - The local truncation of SecureML needs no communication but fails with probability
+ *   about |x| / 2^bitsize, e.g. about 3% for 1.5 * 5.0 with 12 fractional bits in a 32-bit
+ *   ring. It only suits rings that are much wider than the values.
+ * - The interactive truncation opens x + 2^(bitsize - 2) + r with a dealer-generated
+ *   TruncPair and corrects the wrap-around with the most significant bit of r, so it never
+ *   fails for |x| < 2^(bitsize - 2) at the cost of one round.
+ */
+class FixedPointSecretSharing {
+public:
+    /**
+     * @brief Constructs a FixedPointSecretSharing object.
+     *
+     * @param frac_bits The number of fractional bits of the encoding.
+     * @param bitsize The bit size of the ring.
+     */
+    FixedPointSecretSharing(const uint32_t frac_bits, const uint32_t bitsize = 32);
+
+    /**
+     * @brief Gets the number of fractional bits of the encoding.
+     */
+    uint32_t GetFracBits() const;
+
+    /**
+     * @brief Encodes a real value as a ring element.
+     *
+     * @param x The real value to be encoded.
+     * @return The fixed-point encoding of 'x'.
+     */
+    uint32_t Encode(const double x) const;
+
+    /**
+     * @brief Encodes a vector of real values as ring elements.
+     *
+     * @param x_vec The real values to be encoded.
+     * @return The fixed-point encodings of 'x_vec'.
+     */
+    std::vector<uint32_t> Encode(const std::vector<double> &x_vec) const;
+
+    /**
+     * @brief Decodes a ring element as a real value.
+     *
+     * @param x The fixed-point encoding.
+     * @return The decoded real value.
+     */
+    double Decode(const uint32_t x) const;
+
+    /**
+     * @brief Decodes a vector of ring elements as real values.
+     *
+     * @param x_vec The fixed-point encodings.
+     * @return The decoded real values.
+     */
+    std::vector<double> Decode(const std::vector<uint32_t> &x_vec) const;
+
+    /**
+     * @brief Truncates a share by 'frac_bits' bits without communication.
+     *
+     * @param party The party object representing the current party.
+     * @param x The share to be truncated.
+     * @return The truncated share.
+     */
+    uint32_t Truncate(const Party &party, const uint32_t x) const;
+
+    /**
+     * @brief Truncates a vector of shares by 'frac_bits' bits without communication.
+     *
+     * @param party The party object representing the current party.
+     * @param x_vec The shares to be truncated in place.
+     */
+    void Truncate(const Party &party, std::vector<uint32_t> &x_vec) const;
+
+    /**
+     * @brief Generates the plain masks for the interactive truncation.
+     *
+     * @param num The number of masks.
+     * @param tp_vec The generated masks.
+     */
+    void GenerateTruncPairs(const uint32_t num, truncs_t &tp_vec) const;
+
+    /**
+     * @brief Splits plain truncation masks into additive shares for the two parties.
+     *
+     * @param tp_vec The plain masks.
+     * @return A pair of mask shares for party 0 and party 1.
+     */
+    std::pair<truncs_t, truncs_t> ShareTruncPairs(const truncs_t &tp_vec) const;
+
+    /**
+     * @brief Truncates a share by 'frac_bits' bits in one round.
+     *
+     * The shared value must satisfy |x| < 2^(bitsize - 2).
+     *
+     * @param party The party object representing the current party.
+     * @param tp The truncation mask share.
+     * @param x The share to be truncated.
+     * @return The truncated share.
+     */
+    uint32_t Truncate(Party &party, const TruncPair &tp, const uint32_t x) const;
+
+    /**
+     * @brief Truncates a vector of shares by 'frac_bits' bits in one round.
+     *
+     * @param party The party object representing the current party.
+     * @param tp_vec The truncation mask shares (at least as many as the shares).
+     * @param x_vec The shares to be truncated in place.
+     */
+    void Truncate(Party &party, const truncs_t &tp_vec, std::vector<uint32_t> &x_vec) const;
+
+    /**
+     * @brief Performs secure fixed-point multiplication of two secret-shared values.
+     *
+     * Runs AdditiveSecretSharing::Mult and truncates the product locally, so the round
+     * complexity is the same as for the integer multiplication.
+     *
+     * @param party The party object representing the current party.
+     * @param bt The Beaver triplet used for secure multiplication.
+     * @param x The secret-shared fixed-point value of the first operand.
+     * @param y The secret-shared fixed-point value of the second operand.
+     * @return The secret-shared fixed-point product.
+     */
+    uint32_t Mult(Party &party, const BeaverTriplet &bt, const uint32_t x, const uint32_t y) const;
+
+    /**
+     * @brief Performs secure fixed-point multiplication of two vectors of secret-shared values.
+     *
+     * @param party The party object representing the current party.
+     * @param bt_vec The vector of Beaver triplets used for secure multiplication.
+     * @param x_vec The vector of secret-shared fixed-point values of the first operand.
+     * @param y_vec The vector of secret-shared fixed-point values of the second operand.
+     * @param z_vec The vector to store the secret-shared fixed-point products (resized to the size of 'x_vec').
+     */
+    void Mult(Party &party, const bts_t &bt_vec, const std::vector<uint32_t> &x_vec, const std::vector<uint32_t> &y_vec, std::vector<uint32_t> &z_vec) const;
+
+    /**
+     * @brief Performs secure fixed-point multiplication with the interactive truncation.
+     *
+     * Takes one round more than the integer multiplication.
+     *
+     * @param party The party object representing the current party.
+     * @param bt The Beaver triplet used for secure multiplication.
+     * @param tp The truncation mask share.
+     * @param x The secret-shared fixed-point value of the first operand.
+     * @param y The secret-shared fixed-point value of the second operand.
+     * @return The secret-shared fixed-point product.
+     */
+    uint32_t Mult(Party &party, const BeaverTriplet &bt, const TruncPair &tp, const uint32_t x, const uint32_t y) const;
+
+    /**
+     * @brief Performs secure fixed-point multiplication of two vectors with the interactive truncation.
+     *
+     * @param party The party object representing the current party.
+     * @param bt_vec The vector of Beaver triplets used for secure multiplication.
+     * @param tp_vec The truncation mask shares.
+     * @param x_vec The vector of secret-shared fixed-point values of the first operand.
+     * @param y_vec The vector of secret-shared fixed-point values of the second operand.
+     * @param z_vec The vector to store the secret-shared fixed-point products (resized to the size of 'x_vec').
+     */
+    void Mult(Party &party, const bts_t &bt_vec, const truncs_t &tp_vec, const std::vector<uint32_t> &x_vec, const std::vector<uint32_t> &y_vec, std::vector<uint32_t> &z_vec) const;
+
+private:
+    const uint32_t              frac_bits_; /**< Number of fractional bits. */
+    const uint32_t              bitsize_;   /**< Bit size of the ring. */
+    const AdditiveSecretSharing ss_;        /**< Additive secret sharing over the ring. */
+
+    /**
+     * @brief Computes the truncated share from the opened value c = x + 2^(bitsize - 2) + r.
+     */
+    uint32_t TruncateOpened(const Party &party, const TruncPair &tp, const uint32_t c) const;
+};
+
+}    // namespace secret_sharing
+}    // namespace tools
+
+#endif    // FIXED_POINT_H_
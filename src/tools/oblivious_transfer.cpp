@@ -0,0 +1,392 @@
+#include "oblivious_transfer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/evp.h>
+#include <openssl/obj_mac.h>
+#include <stdexcept>
+
+#include "../utils/logger.hpp"
+
+namespace {
+
+using tools::ot::bitvec_t;
+using tools::ot::block_t;
+using tools::secret_sharing::Party;
+
+constexpr size_t kPointSize  = 33;    // Size of a compressed P-256 point in bytes
+constexpr size_t kPointWords = 9;     // Number of uint32_t words used to send a point
+constexpr size_t kHashChunk  = 1024;  // Minimum number of OTs hashed per chunk
+
+// Fixed AES key of the correlation-robust hash
+constexpr std::array<uint8_t, 16> kHashKey = {0x61, 0x7e, 0x8d, 0xa2, 0xa0, 0x51, 0x1e, 0x96, 0x5e, 0x41, 0xc2, 0x9b, 0x15, 0x3f, 0xc7, 0x7a};
+
+void Fatal(const std::string &msg) {
+    utils::Logger::FatalLog(LOCATION, msg);
+    exit(EXIT_FAILURE);
+}
+
+/**
+ * @brief Fixed-key AES used as a tweakable correlation-robust hash H(j, x) = pi(pi(x) ^ j) ^ pi(x).
+ */
+class CrHash {
+public:
+    CrHash()
+        : ctx_(EVP_CIPHER_CTX_new()) {
+        if (this->ctx_ == nullptr || EVP_EncryptInit_ex(this->ctx_, EVP_aes_128_ecb(), nullptr, kHashKey.data(), nullptr) != 1) {
+            Fatal("Failed to initialize the correlation-robust hash");
+        }
+        EVP_CIPHER_CTX_set_padding(this->ctx_, 0);
+    }
+
+    ~CrHash() {
+        EVP_CIPHER_CTX_free(this->ctx_);
+    }
+
+    CrHash(const CrHash &)            = delete;
+    CrHash &operator=(const CrHash &) = delete;
+
+    // Hash 'num' blocks with tweaks 'tweak', 'tweak' + 1, ... in place.
+    void Hash(block_t *data, const size_t num, const uint64_t tweak) {
+        std::vector<block_t> perm(data, data + num);
+        this->Permute(perm.data(), num);
+        for (size_t j = 0; j < num; j++) {
+            data[j]    = perm[j];
+            data[j][0] ^= tweak + j;
+        }
+        this->Permute(data, num);
+        for (size_t j = 0; j < num; j++) {
+            data[j][0] ^= perm[j][0];
+            data[j][1] ^= perm[j][1];
+        }
+    }
+
+private:
+    EVP_CIPHER_CTX *ctx_;
+
+    void Permute(block_t *data, const size_t num) {
+        int out_len;
+        if (num > 0 && EVP_EncryptUpdate(this->ctx_, reinterpret_cast<uint8_t *>(data), &out_len, reinterpret_cast<const uint8_t *>(data), static_cast<int>(num * sizeof(block_t))) != 1) {
+            Fatal("Failed to evaluate the correlation-robust hash");
+        }
+    }
+};
+
+/**
+ * @brief Transposes a 64x64 bit matrix in place (bit i of a[j] <-> bit j of a[i]).
+ */
+void Transpose64(uint64_t a[64]) {
+    uint64_t mask = 0x00000000FFFFFFFFULL;
+    for (uint32_t width = 32; width != 0; width >>= 1, mask ^= (mask << width)) {
+        for (uint32_t k = 0; k < 64; k = ((k | width) + 1) & ~width) {
+            uint64_t t = ((a[k] >> width) ^ a[k | width]) & mask;
+            a[k] ^= t << width;
+            a[k | width] ^= t;
+        }
+    }
+}
+
+/**
+ * @brief Transposes 128 columns of packed bits into rows of 128-bit blocks.
+ *
+ * @param columns The 128 columns, each holding 'num_words' 64-bit words.
+ * @param num_words The number of 64-bit words per column.
+ * @param rows The output rows (size 64 * num_words); bit i of row j is bit j of column i.
+ * @param pool The thread pool running the chunks.
+ */
+void TransposeColumns(const std::vector<uint64_t> &columns, const size_t num_words, std::vector<block_t> &rows, utils::ThreadPool &pool) {
+    rows.resize(num_words * 64);
+    pool.ParallelFor(num_words, [&](const uint32_t, const size_t begin, const size_t end) {
+        uint64_t tmp[64];
+        for (size_t w = begin; w < end; w++) {
+            for (size_t half = 0; half < 2; half++) {
+                for (size_t i = 0; i < 64; i++) {
+                    tmp[i] = columns[(half * 64 + i) * num_words + w];
+                }
+                Transpose64(tmp);
+                for (size_t j = 0; j < 64; j++) {
+                    rows[w * 64 + j][half] = tmp[j];
+                }
+            }
+        }
+    }, 1);
+}
+
+// ##############################
+// ######## EC utilities ########
+// ##############################
+
+struct EcContext {
+    EC_GROUP *group;
+    BN_CTX   *bn_ctx;
+
+    EcContext()
+        : group(EC_GROUP_new_by_curve_name(NID_X9_62_prime256v1)), bn_ctx(BN_CTX_new()) {
+        if (this->group == nullptr || this->bn_ctx == nullptr) {
+            Fatal("Failed to initialize the elliptic curve group");
+        }
+    }
+
+    ~EcContext() {
+        BN_CTX_free(this->bn_ctx);
+        EC_GROUP_free(this->group);
+    }
+
+    EcContext(const EcContext &)            = delete;
+    EcContext &operator=(const EcContext &) = delete;
+};
+
+using BnPtr = std::unique_ptr<BIGNUM, decltype(&BN_clear_free)>;
+using PtPtr = std::unique_ptr<EC_POINT, decltype(&EC_POINT_free)>;
+
+BnPtr RandomScalar(const EcContext &ec) {
+    BnPtr scalar(BN_new(), BN_clear_free);
+    if (!scalar || BN_rand_range(scalar.get(), EC_GROUP_get0_order(ec.group)) != 1) {
+        Fatal("Failed to sample a random scalar");
+    }
+    return scalar;
+}
+
+PtPtr NewPoint(const EcContext &ec) {
+    PtPtr point(EC_POINT_new(ec.group), EC_POINT_free);
+    if (!point) {
+        Fatal("Failed to allocate an elliptic curve point");
+    }
+    return point;
+}
+
+void EncodePoint(const EcContext &ec, const EC_POINT *point, uint32_t *out) {
+    std::array<uint8_t, kPointWords * sizeof(uint32_t)> buf{};
+    if (EC_POINT_point2oct(ec.group, point, POINT_CONVERSION_COMPRESSED, buf.data(), kPointSize, ec.bn_ctx) != kPointSize) {
+        Fatal("Failed to encode an elliptic curve point");
+    }
+    std::memcpy(out, buf.data(), buf.size());
+}
+
+PtPtr DecodePoint(const EcContext &ec, const uint32_t *in) {
+    std::array<uint8_t, kPointWords * sizeof(uint32_t)> buf;
+    std::memcpy(buf.data(), in, buf.size());
+    PtPtr point = NewPoint(ec);
+    if (EC_POINT_oct2point(ec.group, point.get(), buf.data(), kPointSize, ec.bn_ctx) != 1) {
+        Fatal("Received an invalid elliptic curve point");
+    }
+    return point;
+}
+
+// Key derivation H(index, point) truncated to 128 bits
+block_t HashPoint(const EcContext &ec, const uint32_t index, const EC_POINT *point) {
+    std::array<uint8_t, 4 + kPointSize> buf;
+    std::memcpy(buf.data(), &index, sizeof(index));
+    if (EC_POINT_point2oct(ec.group, point, POINT_CONVERSION_COMPRESSED, buf.data() + 4, kPointSize, ec.bn_ctx) != kPointSize) {
+        Fatal("Failed to encode an elliptic curve point");
+    }
+    std::array<uint8_t, 32> digest;
+    unsigned int            digest_len;
+    if (EVP_Digest(buf.data(), buf.size(), digest.data(), &digest_len, EVP_sha256(), nullptr) != 1) {
+        Fatal("Failed to hash an elliptic curve point");
+    }
+    block_t key;
+    std::memcpy(key.data(), digest.data(), sizeof(key));
+    return key;
+}
+
+tools::rng::seed_t BlockToSeed(const block_t &block) {
+    tools::rng::seed_t seed;
+    std::memcpy(seed.data(), block.data(), sizeof(seed));
+    return seed;
+}
+
+}    // namespace
+
+namespace tools {
+namespace ot {
+
+void BaseOt::Run(secret_sharing::Party &party, const uint32_t num, const std::vector<uint32_t> &choices, std::vector<std::array<block_t, 2>> &send_keys, std::vector<block_t> &recv_keys) {
+    EcContext ec;
+
+    // Round 1: exchange A = aG (sender role)
+    BnPtr                 a   = RandomScalar(ec);
+    PtPtr                 A   = NewPoint(ec);
+    EC_POINT_mul(ec.group, A.get(), a.get(), nullptr, nullptr, ec.bn_ctx);
+    std::vector<uint32_t> a_send(kPointWords), a_recv(kPointWords);
+    EncodePoint(ec, A.get(), a_send.data());
+    party.Exchange(a_send, a_recv);
+    PtPtr other_A = DecodePoint(ec, a_recv.data());
+
+    // Round 2: exchange B_i = b_i G + c_i A' (receiver role)
+    std::vector<BnPtr>    b_vec;
+    std::vector<uint32_t> b_send(num * kPointWords), b_recv(num * kPointWords);
+    for (uint32_t i = 0; i < num; i++) {
+        b_vec.push_back(RandomScalar(ec));
+        PtPtr B = NewPoint(ec);
+        EC_POINT_mul(ec.group, B.get(), b_vec[i].get(), nullptr, nullptr, ec.bn_ctx);
+        if (choices[i] & 1U) {
+            EC_POINT_add(ec.group, B.get(), B.get(), other_A.get(), ec.bn_ctx);
+        }
+        EncodePoint(ec, B.get(), b_send.data() + i * kPointWords);
+    }
+    party.Exchange(b_send, b_recv);
+
+    // Sender keys: k_0 = H(i, aB_i), k_1 = H(i, a(B_i - A))
+    PtPtr neg_aA = NewPoint(ec);
+    EC_POINT_mul(ec.group, neg_aA.get(), nullptr, A.get(), a.get(), ec.bn_ctx);
+    EC_POINT_invert(ec.group, neg_aA.get(), ec.bn_ctx);
+    send_keys.resize(num);
+    for (uint32_t i = 0; i < num; i++) {
+        PtPtr B  = DecodePoint(ec, b_recv.data() + i * kPointWords);
+        PtPtr aB = NewPoint(ec);
+        EC_POINT_mul(ec.group, aB.get(), nullptr, B.get(), a.get(), ec.bn_ctx);
+        send_keys[i][0] = HashPoint(ec, i, aB.get());
+        EC_POINT_add(ec.group, aB.get(), aB.get(), neg_aA.get(), ec.bn_ctx);
+        send_keys[i][1] = HashPoint(ec, i, aB.get());
+    }
+
+    // Receiver keys: k_c = H(i, b_i A')
+    recv_keys.resize(num);
+    for (uint32_t i = 0; i < num; i++) {
+        PtPtr bA = NewPoint(ec);
+        EC_POINT_mul(ec.group, bA.get(), nullptr, other_A.get(), b_vec[i].get(), ec.bn_ctx);
+        recv_keys[i] = HashPoint(ec, i, bA.get());
+    }
+}
+
+IknpOtExtension::IknpOtExtension(secret_sharing::Party &party)
+    : party_(party), is_setup_(false), s_{0, 0}, counter_(0) {
+}
+
+void IknpOtExtension::Setup() {
+    if (this->is_setup_) {
+        return;
+    }
+    // As extension sender, the party is the base OT receiver with random choice bits s
+    std::vector<uint32_t> choices(kSecurityParameter);
+    this->s_ = {rng::SecureRng::Rand64(), rng::SecureRng::Rand64()};
+    for (uint32_t i = 0; i < kSecurityParameter; i++) {
+        choices[i] = static_cast<uint32_t>((this->s_[i / 64] >> (i % 64)) & 1ULL);
+    }
+    std::vector<std::array<block_t, 2>> send_keys;
+    std::vector<block_t>                recv_keys;
+    BaseOt::Run(this->party_, kSecurityParameter, choices, send_keys, recv_keys);
+
+    this->sender_prgs_.clear();
+    this->receiver_prgs_.clear();
+    for (uint32_t i = 0; i < kSecurityParameter; i++) {
+        this->sender_prgs_.push_back(std::make_unique<rng::Prg>(BlockToSeed(recv_keys[i])));
+        this->receiver_prgs_.push_back(std::make_unique<rng::Prg>(BlockToSeed(send_keys[i][0])));
+        this->receiver_prgs_.push_back(std::make_unique<rng::Prg>(BlockToSeed(send_keys[i][1])));
+    }
+    this->is_setup_ = true;
+}
+
+void IknpOtExtension::Extend(const size_t num, const bitvec_t &choices, std::vector<block_t> &q_rows, std::vector<block_t> &t_rows) {
+    this->Setup();
+    const size_t          num_words = (num + 63) / 64;
+    std::vector<uint64_t> t_cols(kSecurityParameter * num_words), q_cols(kSecurityParameter * num_words);
+    std::vector<uint32_t> u_send(2 * kSecurityParameter * num_words), u_recv(2 * kSecurityParameter * num_words);
+    uint64_t             *u_cols = reinterpret_cast<uint64_t *>(u_send.data());
+    utils::ThreadPool    &pool   = this->party_.GetThreadPool();
+
+    // Receiver role: t_i = G(k_0^i), u_i = t_i ^ G(k_1^i) ^ r
+    pool.ParallelFor(kSecurityParameter, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            uint64_t *t_col = t_cols.data() + i * num_words;
+            uint64_t *u_col = u_cols + i * num_words;
+            this->receiver_prgs_[2 * i]->Fill(reinterpret_cast<uint32_t *>(t_col), 2 * num_words);
+            this->receiver_prgs_[2 * i + 1]->Fill(reinterpret_cast<uint32_t *>(u_col), 2 * num_words);
+            for (size_t w = 0; w < num_words; w++) {
+                u_col[w] ^= t_col[w] ^ choices[w];
+            }
+        }
+    }, 1);
+    this->party_.Exchange(u_send, u_recv);
+
+    // Sender role: q_i = G(k_{s_i}^i) ^ (s_i * u_i)
+    const uint64_t *u_other = reinterpret_cast<const uint64_t *>(u_recv.data());
+    pool.ParallelFor(kSecurityParameter, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            uint64_t *q_col = q_cols.data() + i * num_words;
+            this->sender_prgs_[i]->Fill(reinterpret_cast<uint32_t *>(q_col), 2 * num_words);
+            if ((this->s_[i / 64] >> (i % 64)) & 1ULL) {
+                for (size_t w = 0; w < num_words; w++) {
+                    q_col[w] ^= u_other[i * num_words + w];
+                }
+            }
+        }
+    }, 1);
+
+    TransposeColumns(t_cols, num_words, t_rows, pool);
+    TransposeColumns(q_cols, num_words, q_rows, pool);
+    t_rows.resize(num);
+    q_rows.resize(num);
+}
+
+void IknpOtExtension::CorrelatedOt(const size_t num, const std::vector<uint32_t> &delta, const bitvec_t &choices, std::vector<uint32_t> &sender_out, std::vector<uint32_t> &receiver_out) {
+    std::vector<block_t> q_rows, t_rows;
+    this->Extend(num, choices, q_rows, t_rows);
+    const uint64_t tweak = this->counter_;
+    this->counter_ += num;
+
+    // Sender: x_j = H(j, q_j), d_j = x_j + delta_j - H(j, q_j ^ s)
+    std::vector<uint32_t> d_send(num), d_recv(num);
+    sender_out.resize(num);
+    this->party_.GetThreadPool().ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+        CrHash               hash;
+        std::vector<block_t> q0(q_rows.begin() + begin, q_rows.begin() + end), q1(q0);
+        for (block_t &q : q1) {
+            q[0] ^= this->s_[0];
+            q[1] ^= this->s_[1];
+        }
+        hash.Hash(q0.data(), q0.size(), tweak + begin);
+        hash.Hash(q1.data(), q1.size(), tweak + begin);
+        for (size_t j = begin; j < end; j++) {
+            sender_out[j] = static_cast<uint32_t>(q0[j - begin][0]);
+            d_send[j]     = sender_out[j] + delta[j] - static_cast<uint32_t>(q1[j - begin][0]);
+        }
+    }, kHashChunk);
+    this->party_.Exchange(d_send, d_recv);
+
+    // Receiver: y_j = H(j, t_j) + r_j * d_j
+    receiver_out.resize(num);
+    this->party_.GetThreadPool().ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+        CrHash hash;
+        hash.Hash(t_rows.data() + begin, end - begin, tweak + begin);
+        for (size_t j = begin; j < end; j++) {
+            receiver_out[j] = static_cast<uint32_t>(t_rows[j][0]) + (GetBit(choices, j) ? d_recv[j] : 0U);
+        }
+    }, kHashChunk);
+}
+
+void IknpOtExtension::RandomOt(const size_t num, const bitvec_t &choices, bitvec_t &sender_out_0, bitvec_t &sender_out_1, bitvec_t &receiver_out) {
+    std::vector<block_t> q_rows, t_rows;
+    this->Extend(num, choices, q_rows, t_rows);
+    const uint64_t tweak = this->counter_;
+    this->counter_ += num;
+
+    const size_t num_words = (num + 63) / 64;
+    sender_out_0.assign(num_words, 0);
+    sender_out_1.assign(num_words, 0);
+    receiver_out.assign(num_words, 0);
+    // Split on word boundaries so that threads never write to the same word
+    this->party_.GetThreadPool().ParallelFor(num_words, [&](const uint32_t, const size_t word_begin, const size_t word_end) {
+        size_t               begin = word_begin * 64, end = std::min(num, word_end * 64);
+        CrHash               hash;
+        std::vector<block_t> q0(q_rows.begin() + begin, q_rows.begin() + end), q1(q0);
+        for (block_t &q : q1) {
+            q[0] ^= this->s_[0];
+            q[1] ^= this->s_[1];
+        }
+        hash.Hash(q0.data(), q0.size(), tweak + begin);
+        hash.Hash(q1.data(), q1.size(), tweak + begin);
+        hash.Hash(t_rows.data() + begin, end - begin, tweak + begin);
+        for (size_t j = begin; j < end; j++) {
+            SetBit(sender_out_0, j, static_cast<uint32_t>(q0[j - begin][0]));
+            SetBit(sender_out_1, j, static_cast<uint32_t>(q1[j - begin][0]));
+            SetBit(receiver_out, j, static_cast<uint32_t>(t_rows[j][0]));
+        }
+    }, kHashChunk / 64);
+}
+
+}    // namespace ot
+}    // namespace tools
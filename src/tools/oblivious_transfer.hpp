@@ -0,0 +1,130 @@
+#ifndef OBLIVIOUS_TRANSFER_H_
+#define OBLIVIOUS_TRANSFER_H_
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "random_number_generator.hpp"
+#include "secret_sharing.hpp"
+
+namespace tools {
+namespace ot {
+
+using block_t = std::array<uint64_t, 2>;    // 128-bit block
+
+constexpr uint32_t kSecurityParameter = 128;    // Number of base OTs (computational security parameter)
+
+/**
+ * @brief Packed bit vector (bit j is stored at word j / 64, position j % 64).
+ */
+using bitvec_t = std::vector<uint64_t>;
+
+/**
+ * @brief Gets bit 'j' of a packed bit vector.
+ */
+inline uint32_t GetBit(const bitvec_t &bits, const size_t j) {
+    return static_cast<uint32_t>((bits[j >> 6] >> (j & 63)) & 1ULL);
+}
+
+/**
+ * @brief Sets bit 'j' of a packed bit vector.
+ */
+inline void SetBit(bitvec_t &bits, const size_t j, const uint32_t bit) {
+    bits[j >> 6] |= static_cast<uint64_t>(bit & 1U) << (j & 63);
+}
+
+class BaseOt {
+public:
+    /**
+     * @brief Runs random base OTs in both directions at once.
+     *
+     * Implements the Chou-Orlandi "simplest OT" over NIST P-256. The party acts as sender of
+     * 'num' random OTs towards the other party and, simultaneously, as receiver of 'num'
+     * random OTs with the given choice bits. The protocol takes two exchanges.
+     *
+     * @param party The party running the base OTs.
+     * @param num The number of base OTs in each direction.
+     * @param choices The choice bits as receiver (size 'num').
+     * @param send_keys The key pairs (k_0, k_1) as sender (resized to 'num').
+     * @param recv_keys The chosen keys k_{choice} as receiver (resized to 'num').
+     */
+    static void Run(secret_sharing::Party &party, const uint32_t num, const std::vector<uint32_t> &choices, std::vector<std::array<block_t, 2>> &send_keys, std::vector<block_t> &recv_keys);
+};
+
+/**
+ * @class IknpOtExtension
+ * @brief IKNP OT extension running in both directions over the Party channel.
+ *
+ * After one round of base OTs, every call extends OTs in both directions at once: the party
+ * is the sender of 'num' OTs towards the other party and the receiver of 'num' OTs from it.
+ * The local phases (PRG expansion, bit-matrix transposition and hashing) run on the thread
+ * pool of the party.
+ */
+class IknpOtExtension {
+public:
+    /**
+     * @brief Constructs an IknpOtExtension object.
+     *
+     * @param party The party running the OT extension.
+     */
+    explicit IknpOtExtension(secret_sharing::Party &party);
+
+    /**
+     * @brief Runs the base OTs. Called automatically by the first extension if needed.
+     */
+    void Setup();
+
+    /**
+     * @brief Runs correlated OTs over Z_{2^32} in both directions.
+     *
+     * As sender, the party inputs the correlations 'delta' and obtains x_j; the other party
+     * obtains x_j + r_j * delta_j for its choice bit r_j. As receiver, the party inputs the
+     * choice bits 'choices' and obtains y_j = x'_j + choices_j * delta'_j.
+     *
+     * @param num The number of OTs in each direction.
+     * @param delta The correlations as sender (size 'num').
+     * @param choices The packed choice bits as receiver (at least 'num' bits).
+     * @param sender_out The outputs x_j as sender (resized to 'num').
+     * @param receiver_out The outputs y_j as receiver (resized to 'num').
+     */
+    void CorrelatedOt(const size_t num, const std::vector<uint32_t> &delta, const bitvec_t &choices, std::vector<uint32_t> &sender_out, std::vector<uint32_t> &receiver_out);
+
+    /**
+     * @brief Runs random bit OTs in both directions.
+     *
+     * As sender, the party obtains two random bits (m_0, m_1) per OT; as receiver it obtains
+     * m'_{choices_j}. No communication beyond the extension itself is needed.
+     *
+     * @param num The number of OTs in each direction.
+     * @param choices The packed choice bits as receiver (at least 'num' bits).
+     * @param sender_out_0 The packed bits m_0 as sender.
+     * @param sender_out_1 The packed bits m_1 as sender.
+     * @param receiver_out The packed bits m'_{choice} as receiver.
+     */
+    void RandomOt(const size_t num, const bitvec_t &choices, bitvec_t &sender_out_0, bitvec_t &sender_out_1, bitvec_t &receiver_out);
+
+private:
+    secret_sharing::Party                  &party_;         /**< Party running the OT extension. */
+    bool                                    is_setup_;      /**< Flag indicating whether the base OTs have run. */
+    block_t                                 s_;             /**< Choice bits of the base OTs (sender role). */
+    std::vector<std::unique_ptr<rng::Prg>>  sender_prgs_;   /**< PRGs seeded with k_{s_i} (sender role). */
+    std::vector<std::unique_ptr<rng::Prg>>  receiver_prgs_; /**< PRGs seeded with k_0, k_1 (receiver role, interleaved). */
+    uint64_t                                counter_;       /**< Number of OTs extended so far (hash tweak). */
+
+    /**
+     * @brief Extends 'num' OTs in both directions.
+     *
+     * @param num The number of OTs in each direction.
+     * @param choices The packed choice bits as receiver.
+     * @param q_rows The rows q_j = t_j ^ (r_j * s) as sender.
+     * @param t_rows The rows t_j as receiver.
+     */
+    void Extend(const size_t num, const bitvec_t &choices, std::vector<block_t> &q_rows, std::vector<block_t> &t_rows);
+};
+
+}    // namespace ot
+}    // namespace tools
+
+#endif    // OBLIVIOUS_TRANSFER_H_
@@ -0,0 +1,86 @@
+#include "ot_triple_generator.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "../utils/utils.hpp"
+#include "random_number_generator.hpp"
+
+namespace tools {
+namespace ot {
+
+OtTripleGenerator::OtTripleGenerator(secret_sharing::Party &party, const uint32_t bitsize, const uint32_t batch_size)
+    : bitsize_(bitsize), batch_size_(batch_size), ote_(party) {
+    if (bitsize <= 1 || bitsize > 32) {
+        throw std::invalid_argument("The bit size must be between 2 and 32.");
+    }
+    if (batch_size == 0) {
+        throw std::invalid_argument("The batch size must be greater than 0.");
+    }
+}
+
+void OtTripleGenerator::GenerateArithmeticTriples(const uint32_t bt_num, secret_sharing::bts_t &bt_vec) {
+    bt_vec.resize(bt_num);
+    for (uint32_t offset = 0; offset < bt_num; offset += this->batch_size_) {
+        this->GenerateArithmeticBatch(std::min(this->batch_size_, bt_num - offset), bt_vec.data() + offset);
+    }
+}
+
+void OtTripleGenerator::GenerateBooleanTriples(const uint32_t bt_num, secret_sharing::bts_t &bt_vec) {
+    bt_vec.resize(bt_num);
+    for (uint32_t offset = 0; offset < bt_num; offset += this->batch_size_) {
+        this->GenerateBooleanBatch(std::min(this->batch_size_, bt_num - offset), bt_vec.data() + offset);
+    }
+}
+
+void OtTripleGenerator::GenerateArithmeticBatch(const uint32_t num, secret_sharing::BeaverTriplet *bts) {
+    const uint32_t        l       = this->bitsize_;
+    const size_t          num_ots = static_cast<size_t>(num) * l;
+    std::vector<uint32_t> a_vec(num), b_vec(num);
+    rng::Prg              prg(rng::Prg::GenerateSeed());
+    prg.Fill(a_vec.data(), num);
+    prg.Fill(b_vec.data(), num);
+
+    // Gilboa multiplication: OT (t, k) has correlation a_t * 2^k and choice bit k of b_t
+    std::vector<uint32_t> delta(num_ots);
+    bitvec_t              choices((num_ots + 63) / 64, 0);
+    for (size_t t = 0; t < num; t++) {
+        a_vec[t] = utils::Mod(a_vec[t], l);
+        b_vec[t] = utils::Mod(b_vec[t], l);
+        for (uint32_t k = 0; k < l; k++) {
+            delta[t * l + k] = a_vec[t] << k;
+            SetBit(choices, t * l + k, b_vec[t] >> k);
+        }
+    }
+    std::vector<uint32_t> sender_out, receiver_out;
+    this->ote_.CorrelatedOt(num_ots, delta, choices, sender_out, receiver_out);
+
+    // c = a * b + (share of a * b') + (share of a' * b)
+    for (size_t t = 0; t < num; t++) {
+        uint32_t cross = 0;
+        for (uint32_t k = 0; k < l; k++) {
+            cross += receiver_out[t * l + k] - sender_out[t * l + k];
+        }
+        bts[t] = secret_sharing::BeaverTriplet(a_vec[t], b_vec[t], utils::Mod(a_vec[t] * b_vec[t] + cross, l));
+    }
+}
+
+void OtTripleGenerator::GenerateBooleanBatch(const uint32_t num, secret_sharing::BeaverTriplet *bts) {
+    // Random choice bits b
+    bitvec_t choices((num + 63) / 64);
+    rng::Prg prg(rng::Prg::GenerateSeed());
+    prg.Fill(reinterpret_cast<uint32_t *>(choices.data()), 2 * choices.size());
+
+    // As sender: a = m_0 ^ m_1 and a * b' = m_0 ^ m'_{b'}; as receiver: v = m'_b
+    bitvec_t m0, m1, v;
+    this->ote_.RandomOt(num, choices, m0, m1, v);
+    for (size_t t = 0; t < num; t++) {
+        uint32_t a = GetBit(m0, t) ^ GetBit(m1, t);
+        uint32_t b = GetBit(choices, t);
+        uint32_t c = (a & b) ^ GetBit(m0, t) ^ GetBit(v, t);
+        bts[t]     = secret_sharing::BeaverTriplet(a, b, c);
+    }
+}
+
+}    // namespace ot
+}    // namespace tools
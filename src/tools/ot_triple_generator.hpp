@@ -0,0 +1,72 @@
+#ifndef OT_TRIPLE_GENERATOR_H_
+#define OT_TRIPLE_GENERATOR_H_
+
+#include <cstdint>
+
+#include "oblivious_transfer.hpp"
+#include "secret_sharing.hpp"
+
+namespace tools {
+namespace ot {
+
+/**
+ * @class OtTripleGenerator
+ * @brief Dealer-free Beaver triple generation between the two parties.
+ *
+ * Arithmetic triples use Gilboa multiplication over correlated OTs (one OT per bit of the
+ * ring for each cross term), and Boolean triples use one random OT per cross term. All OTs
+ * come from IKNP OT extension over the Party channel and are produced in batches, each
+ * costing two exchanges for arithmetic triples and one for Boolean triples.
+ *
+ * The local phases run on the thread pool of the party (see Party::SetNumThreads).
+ * The generator uses the Party channel exclusively while it runs. To overlap generation with
+ * the online phase, run it on a dedicated Party (e.g. another port) and feed a TriplePool via
+ * TriplePool::StartFromGenerator.
+ */
+class OtTripleGenerator {
+public:
+    /**
+     * @brief Constructs an OtTripleGenerator object.
+     *
+     * @param party The party generating the triples.
+     * @param bitsize The bit size of the arithmetic ring.
+     * @param batch_size The number of triples generated per batch.
+     */
+    OtTripleGenerator(secret_sharing::Party &party, const uint32_t bitsize = 32, const uint32_t batch_size = 1U << 13);
+
+    /**
+     * @brief Generates arithmetic Beaver triple shares.
+     *
+     * @param bt_num The number of Beaver triples to generate.
+     * @param bt_vec The vector to store the Beaver triple shares of this party (resized to 'bt_num').
+     */
+    void GenerateArithmeticTriples(const uint32_t bt_num, secret_sharing::bts_t &bt_vec);
+
+    /**
+     * @brief Generates Boolean Beaver triple shares.
+     *
+     * @param bt_num The number of Beaver triples to generate.
+     * @param bt_vec The vector to store the Beaver triple shares of this party (resized to 'bt_num').
+     */
+    void GenerateBooleanTriples(const uint32_t bt_num, secret_sharing::bts_t &bt_vec);
+
+private:
+    const uint32_t  bitsize_;    /**< Bit size of the arithmetic ring. */
+    const uint32_t  batch_size_; /**< Number of triples generated per batch. */
+    IknpOtExtension ote_;        /**< OT extension running in both directions. */
+
+    /**
+     * @brief Generates one batch of arithmetic triples into bt_vec[offset, offset + num).
+     */
+    void GenerateArithmeticBatch(const uint32_t num, secret_sharing::BeaverTriplet *bts);
+
+    /**
+     * @brief Generates one batch of Boolean triples into bt_vec[offset, offset + num).
+     */
+    void GenerateBooleanBatch(const uint32_t num, secret_sharing::BeaverTriplet *bts);
+};
+
+}    // namespace ot
+}    // namespace tools
+
+#endif    // OT_TRIPLE_GENERATOR_H_
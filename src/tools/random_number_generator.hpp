@@ -1,7 +1,13 @@
 #ifndef RNG_RANDOM_NUMBER_GENERATOR_H_
 #define RNG_RANDOM_NUMBER_GENERATOR_H_
 
+#include <algorithm>
 #include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <openssl/evp.h>
 #include <openssl/rand.h>
 #include <random>
 
@@ -15,7 +21,8 @@ std::mt19937       mtrng(kFixedSeed);    // Mersenne Twister 19937 random number
 namespace tools {
 namespace rng {
 
-using byte = uint8_t;    // Alias for a byte
+using byte   = uint8_t;                    // Alias for a byte
+using seed_t = std::array<uint32_t, 4>;    // 128-bit PRG seed
 
 class SecureRng {
 public:
@@ -64,6 +71,101 @@ private:
     }
 };
 
+/**
+ * @class Prg
+ * @brief Seeded pseudorandom generator based on AES-128 in counter mode.
+ *
+ * Two Prg objects constructed from the same 16-byte seed produce the same stream,
+ * which allows a share to be replaced by its seed and expanded on demand.
+ */
+class Prg {
+public:
+    explicit Prg(const seed_t &seed)
+        : ctx_(EVP_CIPHER_CTX_new()), pos_(kBufferWords) {
+        std::array<byte, 16> key, iv{};
+        std::memcpy(key.data(), seed.data(), key.size());
+        if (this->ctx_ == nullptr || EVP_EncryptInit_ex(this->ctx_, EVP_aes_128_ctr(), nullptr, key.data(), iv.data()) != 1) {
+            std::perror("failed to initialize PRG");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    ~Prg() {
+        EVP_CIPHER_CTX_free(this->ctx_);
+    }
+
+    Prg(const Prg &)            = delete;
+    Prg &operator=(const Prg &) = delete;
+
+    // Generate a fresh random seed.
+    static inline seed_t GenerateSeed() {
+        seed_t seed;
+        for (uint32_t &word : seed) {
+            word = SecureRng::Rand32();
+        }
+        return seed;
+    }
+
+    // Generate a pseudorandom 32-bit number.
+    inline uint32_t Rand32() {
+        if (this->pos_ == kBufferWords) {
+            this->Refill();
+        }
+        return this->buffer_[this->pos_++];
+    }
+
+    // Generate a pseudorandom 64-bit number.
+    inline uint64_t Rand64() {
+        uint64_t hi = this->Rand32();
+        return (hi << 32) | this->Rand32();
+    }
+
+    // Generate a pseudorandom boolean value.
+    inline bool RandBool() {
+        return (this->Rand32() & 0x01) != 0;
+    }
+
+    // Fill 'length' words of 'out' with pseudorandom numbers.
+    inline void Fill(uint32_t *out, const size_t length) {
+        size_t i = 0;
+        // Drain the buffered keystream first, so the stream matches repeated Rand32() calls
+        while (i < length && this->pos_ < kBufferWords) {
+            out[i++] = this->buffer_[this->pos_++];
+        }
+        if (i < length) {
+            std::memset(out + i, 0, (length - i) * sizeof(uint32_t));
+            this->Encrypt(reinterpret_cast<byte *>(out + i), (length - i) * sizeof(uint32_t));
+        }
+    }
+
+private:
+    static constexpr size_t kBufferWords = 256;    // Number of keystream words buffered per refill
+
+    EVP_CIPHER_CTX                     *ctx_;
+    std::array<uint32_t, kBufferWords> buffer_;
+    size_t                              pos_;
+
+    inline void Refill() {
+        this->buffer_.fill(0);
+        this->Encrypt(reinterpret_cast<byte *>(this->buffer_.data()), kBufferWords * sizeof(uint32_t));
+        this->pos_ = 0;
+    }
+
+    // Encrypt 'length' bytes in place, i.e. XOR them with the next bytes of the keystream.
+    inline void Encrypt(byte *data, const size_t length) {
+        size_t offset = 0;
+        while (offset < length) {
+            int chunk = static_cast<int>(std::min<size_t>(length - offset, 1U << 30));
+            int out_len;
+            if (EVP_EncryptUpdate(this->ctx_, data + offset, &out_len, data + offset, chunk) != 1) {
+                std::perror("failed to expand PRG");
+                exit(EXIT_FAILURE);
+            }
+            offset += chunk;
+        }
+    }
+};
+
 }    // namespace rng
 }    // namespace tools
 
@@ -1,16 +1,126 @@
 #include "secret_sharing.hpp"
 
+#include "../utils/logger.hpp"
 #include "../utils/utils.hpp"
 #include "random_number_generator.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <stdexcept>
+#include <type_traits>
 
 namespace tools {
 namespace secret_sharing {
 
+namespace {
+
+/**
+ * @brief Draws one fresh PRG seed per chunk on the calling thread, so that the chunks share no RNG state.
+ */
+std::vector<rng::seed_t> GenerateChunkSeeds(const uint32_t num_chunks) {
+    std::vector<rng::seed_t> seeds(num_chunks);
+    for (rng::seed_t &seed : seeds) {
+        seed = rng::Prg::GenerateSeed();
+    }
+    return seeds;
+}
+
+/**
+ * @brief Calls func(std::true_type) for party 0 and func(std::false_type) for party 1.
+ *
+ * Kernels branch on the role with 'if constexpr', so the role is resolved once per call
+ * instead of once per element.
+ */
+template <typename Func>
+void DispatchByRole(const Party &party, Func &&func) {
+    if (party.GetId() == 0) {
+        func(std::true_type{});
+    } else {
+        func(std::false_type{});
+    }
+}
+
+/**
+ * @brief Arithmetic over Z_{2^bitsize} for the Beaver kernels of MultBatch.
+ */
+struct AdditiveOps {
+    uint32_t bitsize; /**< Bit size of the ring. */
+
+    uint32_t Add(const uint32_t x, const uint32_t y) const {
+        return utils::Mod(x + y, this->bitsize);
+    }
+    uint32_t Sub(const uint32_t x, const uint32_t y) const {
+        return utils::Mod(x - y, this->bitsize);
+    }
+    uint32_t Combine(const BeaverTriplet &bt, const uint32_t d, const uint32_t e) const {
+        return (e * bt.a) + (d * bt.b) + bt.c;
+    }
+    uint32_t AddPublic(const uint32_t z, const uint32_t d, const uint32_t e) const {
+        return z + (d * e);
+    }
+    uint32_t Reduce(const uint32_t x) const {
+        return utils::Mod(x, this->bitsize);
+    }
+};
+
+/**
+ * @brief Arithmetic over GF(2) (bits or packed words) for the Beaver kernels of MultBatch.
+ */
+struct BooleanOps {
+    uint32_t Add(const uint32_t x, const uint32_t y) const {
+        return x ^ y;
+    }
+    uint32_t Sub(const uint32_t x, const uint32_t y) const {
+        return x ^ y;
+    }
+    uint32_t Combine(const BeaverTriplet &bt, const uint32_t d, const uint32_t e) const {
+        return (e & bt.a) ^ (d & bt.b) ^ bt.c;
+    }
+    uint32_t AddPublic(const uint32_t z, const uint32_t d, const uint32_t e) const {
+        return z ^ (d & e);
+    }
+    uint32_t Reduce(const uint32_t x) const {
+        return x;
+    }
+};
+
+/**
+ * @brief Computes the masked differences (x - a, y - b) of a group of Beaver multiplications.
+ */
+template <typename Ops>
+void MaskDifferences(utils::ThreadPool &pool, const Ops &ops, utils::Span<const BeaverTriplet> bt_vec, utils::Span<const uint32_t> x_vec, utils::Span<const uint32_t> y_vec, uint32_t *de, const size_t num) {
+    pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            de[2 * i]     = ops.Sub(x_vec[i], bt_vec[i].a);
+            de[2 * i + 1] = ops.Sub(y_vec[i], bt_vec[i].b);
+        }
+    });
+}
+
+/**
+ * @brief Combines the opened differences of a group of Beaver multiplications into product shares.
+ */
+template <bool IsParty0, typename Ops>
+void CombineProducts(utils::ThreadPool &pool, const Ops &ops, utils::Span<const BeaverTriplet> bt_vec, const uint32_t *de_own, const uint32_t *de_other, utils::Span<uint32_t> z_vec) {
+    pool.ParallelFor(z_vec.size(), [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            const uint32_t d = ops.Add(de_own[2 * i], de_other[2 * i]);
+            const uint32_t e = ops.Add(de_own[2 * i + 1], de_other[2 * i + 1]);
+            // Only party 0 adds the public term d * e (d & e).
+            if constexpr (IsParty0) {
+                z_vec[i] = ops.Reduce(ops.AddPublic(ops.Combine(bt_vec[i], d, e), d, e));
+            } else {
+                z_vec[i] = ops.Reduce(ops.Combine(bt_vec[i], d, e));
+            }
+        }
+    });
+}
+
+}    // namespace
+
 Party::Party(const comm::CommInfo &comm_info)
-    : id_(comm_info.party_id), p0_(comm::Server(comm_info.port_number, false)), p1_(comm::Client(comm_info.host_address, comm_info.port_number, false)), is_started_(false) {
+    : id_(comm_info.party_id), p0_(comm::Server(comm_info.port_number, false)), p1_(comm::Client(comm_info.host_address, comm_info.port_number, false)), is_started_(false), pool_(std::make_shared<utils::ThreadPool>(1)), workspace_(std::make_shared<utils::Workspace>()) {
 }
 
 void Party::StartCommunication(const bool debug) {
@@ -34,6 +144,16 @@ void Party::StartCommunication(const bool debug) {
     // Set the flag to indicate that communication has started
     this->is_started_ = true;
 
+    // Agree on the PRSS seeds: the common seed is the XOR of one fresh seed from each party
+    rng::seed_t own_seed = rng::Prg::GenerateSeed(), peer_seed{};
+    this->Exchange(own_seed, peer_seed);
+    for (size_t i = 0; i < own_seed.size(); i++) {
+        own_seed[i] ^= peer_seed[i];
+    }
+    this->common_prg_ = std::make_shared<rng::Prg>(own_seed);
+    this->own_prg_    = std::make_shared<rng::Prg>(rng::Prg::GenerateSeed());
+    // The seed agreement is setup traffic and is not counted
+    this->ClearTotalBytesSent();
 }
 
 void Party::EndCommunication() {
@@ -45,6 +165,38 @@ uint32_t Party::GetId() const {
     return this->id_;
 }
 
+void Party::SetNumThreads(const uint32_t num_threads) {
+    if (num_threads != this->pool_->GetNumThreads()) {
+        this->pool_ = std::make_shared<utils::ThreadPool>(num_threads);
+    }
+}
+
+uint32_t Party::GetNumThreads() const {
+    return this->pool_->GetNumThreads();
+}
+
+utils::ThreadPool &Party::GetThreadPool() const {
+    return *this->pool_;
+}
+
+utils::Workspace &Party::GetWorkspace() const {
+    return *this->workspace_;
+}
+
+rng::Prg &Party::GetCommonPrg() const {
+    if (!this->common_prg_) {
+        throw std::logic_error("The PRSS seeds are agreed in StartCommunication.");
+    }
+    return *this->common_prg_;
+}
+
+rng::Prg &Party::GetOwnPrg() const {
+    if (!this->own_prg_) {
+        throw std::logic_error("The PRSS seeds are agreed in StartCommunication.");
+    }
+    return *this->own_prg_;
+}
+
 void Party::SendRecv(uint32_t &x_0, uint32_t &x_1) {
     if (id_ == 0) {
         this->p0_.SendValue(x_0);
@@ -85,6 +237,35 @@ void Party::SendRecv(std::array<uint32_t, 4> &x_arr_0, std::array<uint32_t, 4> &
     }
 }
 
+void Party::Exchange(utils::Span<const uint32_t> send, utils::Span<uint32_t> recv) {
+    if (send.size() != recv.size()) {
+        throw std::invalid_argument("The sizes of the send and receive buffers must match.");
+    }
+    if (this->id_ == 0) {
+        this->p0_.SendBuffer(send.data(), send.size());
+        this->p0_.RecvBuffer(recv.data(), recv.size());
+    } else {
+        this->p1_.RecvBuffer(recv.data(), recv.size());
+        this->p1_.SendBuffer(send.data(), send.size());
+    }
+}
+
+void Party::Send(utils::Span<const uint32_t> send) {
+    if (this->id_ == 0) {
+        this->p0_.SendBuffer(send.data(), send.size());
+    } else {
+        this->p1_.SendBuffer(send.data(), send.size());
+    }
+}
+
+void Party::Recv(utils::Span<uint32_t> recv) {
+    if (this->id_ == 0) {
+        this->p0_.RecvBuffer(recv.data(), recv.size());
+    } else {
+        this->p1_.RecvBuffer(recv.data(), recv.size());
+    }
+}
+
 uint32_t Party::GetTotalBytesSent() const {
     if (this->id_ == 0) {
         return this->p0_.GetTotalBytesSent();
@@ -161,17 +342,79 @@ shares_t AdditiveSecretSharing::Share(const std::vector<uint32_t> &x_vec) const
     return std::make_pair(x_vec_0, x_vec_1);
 }
 
-void AdditiveSecretSharing::Reconst(Party &party, std::vector<uint32_t> &x_vec_0, std::vector<uint32_t> &x_vec_1, std::vector<uint32_t> &output) const {
-    size_t length = output.size();
-    party.SendRecv(x_vec_0, x_vec_1);
+shares_t AdditiveSecretSharing::Share(const std::vector<uint32_t> &x_vec, utils::ThreadPool &pool) const {
+    size_t                   length = x_vec.size();
+    std::vector<uint32_t>    x_vec_0(length);
+    std::vector<uint32_t>    x_vec_1(length);
+    std::vector<rng::seed_t> seeds = GenerateChunkSeeds(pool.GetNumChunks(length));
+    pool.ParallelFor(length, [&](const uint32_t chunk_id, const size_t begin, const size_t end) {
+        rng::Prg(seeds[chunk_id]).Fill(x_vec_0.data() + begin, end - begin);
+        for (size_t i = begin; i < end; i++) {
+            x_vec_0[i] = utils::Mod(x_vec_0[i], this->bitsize_);
+            x_vec_1[i] = utils::Mod(x_vec[i] - x_vec_0[i], this->bitsize_);
+        }
+    });
+    return std::make_pair(x_vec_0, x_vec_1);
+}
+
+seeded_shares_t AdditiveSecretSharing::ShareWithSeed(const std::vector<uint32_t> &x_vec) const {
+    size_t                length = x_vec.size();
+    ShareSeed             x_seed{rng::Prg::GenerateSeed(), static_cast<uint32_t>(length)};
+    std::vector<uint32_t> x_vec_1(length);
+    // x_1 = x - PRG(seed)
+    rng::Prg(x_seed.seed).Fill(x_vec_1.data(), length);
     for (size_t i = 0; i < length; i++) {
-        output[i] = utils::Mod(x_vec_0[i] + x_vec_1[i], this->bitsize_);
+        x_vec_1[i] = utils::Mod(x_vec[i] - x_vec_1[i], this->bitsize_);
+    }
+    return std::make_pair(x_seed, x_vec_1);
+}
+
+void AdditiveSecretSharing::ExpandShare(const ShareSeed &x_seed, std::vector<uint32_t> &x_vec_0) const {
+    x_vec_0.resize(x_seed.length);
+    rng::Prg(x_seed.seed).Fill(x_vec_0.data(), x_seed.length);
+    for (size_t i = 0; i < x_seed.length; i++) {
+        x_vec_0[i] = utils::Mod(x_vec_0[i], this->bitsize_);
+    }
+}
+
+void AdditiveSecretSharing::RandomShares(Party &party, const uint32_t num, std::vector<uint32_t> &r_vec) const {
+    r_vec.resize(num);
+    party.GetOwnPrg().Fill(r_vec.data(), num);
+    for (size_t i = 0; i < num; i++) {
+        r_vec[i] = utils::Mod(r_vec[i], this->bitsize_);
+    }
+}
+
+void AdditiveSecretSharing::ZeroShares(Party &party, const uint32_t num, std::vector<uint32_t> &z_vec) const {
+    z_vec.resize(num);
+    party.GetCommonPrg().Fill(z_vec.data(), num);
+    // Party 0 takes s and party 1 takes -s.
+    for (size_t i = 0; i < num; i++) {
+        z_vec[i] = utils::Mod((party.GetId() == 0) ? z_vec[i] : 0U - z_vec[i], this->bitsize_);
     }
 }
 
+void AdditiveSecretSharing::Reconst(Party &party, std::vector<uint32_t> &x_vec_0, std::vector<uint32_t> &x_vec_1, std::vector<uint32_t> &output) const {
+    size_t                       length = output.size();
+    const std::vector<uint32_t> &x_own  = (party.GetId() == 0) ? x_vec_0 : x_vec_1;
+    // Receive the peer shares into the workspace instead of the caller's vector
+    utils::Workspace::Frame frame(party.GetWorkspace());
+    utils::Span<uint32_t>   x_peer(party.GetWorkspace().Allocate(x_own.size()), x_own.size());
+    party.Exchange(x_own, x_peer);
+    party.GetThreadPool().ParallelFor(length, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            output[i] = utils::Mod(x_own[i] + x_peer[i], this->bitsize_);
+        }
+    });
+}
+
 void AdditiveSecretSharing::Reconst(Party &party, std::array<uint32_t, 2> &x_arr_0, std::array<uint32_t, 2> &x_arr_1, std::array<uint32_t, 2> &output) const {
     size_t length = output.size();
-    party.SendRecv(x_arr_0, x_arr_1);
+    if (party.GetId() == 0) {
+        party.Exchange(x_arr_0, x_arr_1);
+    } else {
+        party.Exchange(x_arr_1, x_arr_0);
+    }
     for (size_t i = 0; i < length; i++) {
         output[i] = utils::Mod(x_arr_0[i] + x_arr_1[i], this->bitsize_);
     }
@@ -179,12 +422,60 @@ void AdditiveSecretSharing::Reconst(Party &party, std::array<uint32_t, 2> &x_arr
 
 void AdditiveSecretSharing::Reconst(Party &party, std::array<uint32_t, 4> &x_arr_0, std::array<uint32_t, 4> &x_arr_1, std::array<uint32_t, 4> &output) const {
     size_t length = output.size();
-    party.SendRecv(x_arr_0, x_arr_1);
+    if (party.GetId() == 0) {
+        party.Exchange(x_arr_0, x_arr_1);
+    } else {
+        party.Exchange(x_arr_1, x_arr_0);
+    }
     for (size_t i = 0; i < length; i++) {
         output[i] = utils::Mod(x_arr_0[i] + x_arr_1[i], this->bitsize_);
     }
 }
 
+void AdditiveSecretSharing::Reconst(Party &party, utils::Span<uint32_t> x_sh) const {
+    size_t                  length = x_sh.size();
+    utils::Workspace::Frame frame(party.GetWorkspace());
+    utils::Span<uint32_t>   x_peer(party.GetWorkspace().Allocate(length), length);
+    party.Exchange(x_sh, x_peer);
+    party.GetThreadPool().ParallelFor(length, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            x_sh[i] = utils::Mod(x_sh[i] + x_peer[i], this->bitsize_);
+        }
+    });
+}
+
+uint32_t AdditiveSecretSharing::RevealTo(Party &party, const uint32_t party_id, const uint32_t x_sh) const {
+    if (party_id > 1) {
+        throw std::invalid_argument("The party ID must be 0 or 1.");
+    }
+    if (party.GetId() != party_id) {
+        party.Send(utils::Span<const uint32_t>(&x_sh, 1));
+        return 0;
+    }
+    uint32_t x_peer = 0;
+    party.Recv(utils::Span<uint32_t>(&x_peer, 1));
+    return utils::Mod(x_sh + x_peer, this->bitsize_);
+}
+
+void AdditiveSecretSharing::RevealTo(Party &party, const uint32_t party_id, utils::Span<uint32_t> x_sh) const {
+    if (party_id > 1) {
+        throw std::invalid_argument("The party ID must be 0 or 1.");
+    }
+    if (party.GetId() != party_id) {
+        party.Send(x_sh);
+        return;
+    }
+    size_t                  length = x_sh.size();
+    utils::Workspace::Frame frame(party.GetWorkspace());
+    utils::Span<uint32_t>   x_peer(party.GetWorkspace().Allocate(length), length);
+    party.Recv(x_peer);
+    party.GetThreadPool().ParallelFor(length, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            x_sh[i] = utils::Mod(x_sh[i] + x_peer[i], this->bitsize_);
+        }
+    });
+}
+
 void AdditiveSecretSharing::GenerateBeaverTriples(const uint32_t bt_num, bts_t &bt_vec) const {
     for (uint32_t i = 0; i < bt_num; i++) {
         uint32_t val_a = utils::Mod(rng::SecureRng::Rand64(), this->bitsize_);
@@ -208,19 +499,119 @@ std::pair<bts_t, bts_t> AdditiveSecretSharing::ShareBeaverTriples(const bts_t &b
     return std::make_pair(bt_vec_0, bt_vec_1);
 }
 
-uint32_t AdditiveSecretSharing::Mult(Party &party, const BeaverTriplet &bt, const uint32_t x, const uint32_t y) const {
-    uint32_t                z;
-    std::array<uint32_t, 2> de{0, 0}, de_0{0, 0}, de_1{0, 0};
-    // Calculate the differences de_0 and de_1 based on party_id.
-    if (party.GetId() == 0) {
-        de_0[0] = utils::Mod(x - bt.a, this->bitsize_);
-        de_0[1] = utils::Mod(y - bt.b, this->bitsize_);
-    } else {
-        de_1[0] = utils::Mod(x - bt.a, this->bitsize_);
-        de_1[1] = utils::Mod(y - bt.b, this->bitsize_);
+std::pair<bts_t, bts_t> AdditiveSecretSharing::ShareBeaverTriples(const bts_t &bt_vec, utils::ThreadPool &pool) const {
+    bts_t                    bt_vec_0(bt_vec.size());
+    bts_t                    bt_vec_1(bt_vec.size());
+    std::vector<rng::seed_t> seeds = GenerateChunkSeeds(pool.GetNumChunks(bt_vec.size()));
+    pool.ParallelFor(bt_vec.size(), [&](const uint32_t chunk_id, const size_t begin, const size_t end) {
+        std::vector<uint32_t> rand(3 * (end - begin));
+        rng::Prg(seeds[chunk_id]).Fill(rand.data(), rand.size());
+        for (size_t i = begin, j = 0; i < end; i++, j += 3) {
+            bt_vec_0[i].a = utils::Mod(rand[j], this->bitsize_);
+            bt_vec_1[i].a = utils::Mod(bt_vec[i].a - bt_vec_0[i].a, this->bitsize_);
+            bt_vec_0[i].b = utils::Mod(rand[j + 1], this->bitsize_);
+            bt_vec_1[i].b = utils::Mod(bt_vec[i].b - bt_vec_0[i].b, this->bitsize_);
+            bt_vec_0[i].c = utils::Mod(rand[j + 2], this->bitsize_);
+            bt_vec_1[i].c = utils::Mod(bt_vec[i].c - bt_vec_0[i].c, this->bitsize_);
+        }
+    });
+    return std::make_pair(bt_vec_0, bt_vec_1);
+}
+
+cbts_t AdditiveSecretSharing::GenerateCompressedBeaverTriples(const uint32_t bt_num) const {
+    CompressedBeaverTriplets cbt_0{0, bt_num, rng::Prg::GenerateSeed(), {}};
+    CompressedBeaverTriplets cbt_1{1, bt_num, rng::Prg::GenerateSeed(), std::vector<uint32_t>(bt_num)};
+    // Expand (a_0, b_0, c_0) from the seed of party 0 and (a_1, b_1) from the seed of party 1
+    std::vector<uint32_t> rand_0(3 * static_cast<size_t>(bt_num)), rand_1(2 * static_cast<size_t>(bt_num));
+    rng::Prg(cbt_0.seed).Fill(rand_0.data(), rand_0.size());
+    rng::Prg(cbt_1.seed).Fill(rand_1.data(), rand_1.size());
+    for (size_t i = 0; i < bt_num; i++) {
+        uint32_t val_a = rand_0[3 * i] + rand_1[2 * i];
+        uint32_t val_b = rand_0[3 * i + 1] + rand_1[2 * i + 1];
+        // Correction word c_1 = a * b - c_0
+        cbt_1.c_vec[i] = utils::Mod(val_a * val_b - rand_0[3 * i + 2], this->bitsize_);
+    }
+    return std::make_pair(cbt_0, cbt_1);
+}
+
+void AdditiveSecretSharing::ExpandBeaverTriples(const CompressedBeaverTriplets &cbt, bts_t &bt_vec) const {
+    size_t num = cbt.num;
+    if (cbt.party_id != 0 && cbt.c_vec.size() < num) {
+        throw std::invalid_argument("The compressed Beaver triples hold fewer correction words than triples.");
+    }
+    size_t                num_derived = (cbt.party_id == 0) ? 3 : 2;
+    std::vector<uint32_t> rand(num_derived * num);
+    rng::Prg(cbt.seed).Fill(rand.data(), rand.size());
+    bt_vec.resize(num);
+    for (size_t i = 0; i < num; i++) {
+        bt_vec[i].a = utils::Mod(rand[num_derived * i], this->bitsize_);
+        bt_vec[i].b = utils::Mod(rand[num_derived * i + 1], this->bitsize_);
+        bt_vec[i].c = (cbt.party_id == 0) ? utils::Mod(rand[num_derived * i + 2], this->bitsize_) : cbt.c_vec[i];
+    }
+}
+
+BroadcastBeaverTriplets AdditiveSecretSharing::GenerateBroadcastBeaverTriples(const uint32_t bt_num) const {
+    BroadcastBeaverTriplets bbt{utils::Mod(rng::SecureRng::Rand64(), this->bitsize_), std::vector<uint32_t>(bt_num), std::vector<uint32_t>(bt_num)};
+    for (uint32_t i = 0; i < bt_num; i++) {
+        bbt.b_vec[i] = utils::Mod(rng::SecureRng::Rand64(), this->bitsize_);
+        bbt.c_vec[i] = utils::Mod(bbt.a * bbt.b_vec[i], this->bitsize_);
+    }
+    return bbt;
+}
+
+bbts_t AdditiveSecretSharing::ShareBroadcastBeaverTriples(const BroadcastBeaverTriplets &bbt) const {
+    share_t                 a_sh = this->Share(bbt.a);
+    shares_t                b_sh = this->Share(bbt.b_vec);
+    shares_t                c_sh = this->Share(bbt.c_vec);
+    BroadcastBeaverTriplets bbt_0{a_sh.first, std::move(b_sh.first), std::move(c_sh.first)};
+    BroadcastBeaverTriplets bbt_1{a_sh.second, std::move(b_sh.second), std::move(c_sh.second)};
+    return std::make_pair(std::move(bbt_0), std::move(bbt_1));
+}
+
+void AdditiveSecretSharing::GenerateSquarePairs(const uint32_t sp_num, sps_t &sp_vec) const {
+    sp_vec.resize(sp_num);
+    for (uint32_t i = 0; i < sp_num; i++) {
+        uint32_t val_a = utils::Mod(rng::SecureRng::Rand64(), this->bitsize_);
+        sp_vec[i]      = SquarePair{val_a, utils::Mod(val_a * val_a, this->bitsize_)};
     }
-    // Calculate the final differences de based on de_0 and de_1.
-    Reconst(party, de_0, de_1, de);
+}
+
+std::pair<sps_t, sps_t> AdditiveSecretSharing::ShareSquarePairs(const sps_t &sp_vec) const {
+    sps_t sp_vec_0(sp_vec.size());
+    sps_t sp_vec_1(sp_vec.size());
+    for (size_t i = 0; i < sp_vec.size(); i++) {
+        sp_vec_0[i].a  = utils::Mod(rng::SecureRng::Rand64(), this->bitsize_);
+        sp_vec_1[i].a  = utils::Mod(sp_vec[i].a - sp_vec_0[i].a, this->bitsize_);
+        sp_vec_0[i].aa = utils::Mod(rng::SecureRng::Rand64(), this->bitsize_);
+        sp_vec_1[i].aa = utils::Mod(sp_vec[i].aa - sp_vec_0[i].aa, this->bitsize_);
+    }
+    return std::make_pair(sp_vec_0, sp_vec_1);
+}
+
+PowerTuples AdditiveSecretSharing::GeneratePowerTuples(const uint32_t num, const uint32_t degree) const {
+    PowerTuples pt{num, degree, std::vector<uint32_t>(static_cast<size_t>(num) * degree)};
+    for (size_t i = 0; i < num; i++) {
+        uint32_t val_r = utils::Mod(rng::SecureRng::Rand64(), this->bitsize_);
+        uint32_t power = 1;
+        for (size_t j = 0; j < degree; j++) {
+            power                      = utils::Mod(power * val_r, this->bitsize_);
+            pt.powers[i * degree + j] = power;
+        }
+    }
+    return pt;
+}
+
+pts_t AdditiveSecretSharing::SharePowerTuples(const PowerTuples &pt) const {
+    shares_t powers_sh = this->Share(pt.powers);
+    return std::make_pair(PowerTuples{pt.num, pt.degree, std::move(powers_sh.first)}, PowerTuples{pt.num, pt.degree, std::move(powers_sh.second)});
+}
+
+uint32_t AdditiveSecretSharing::Mult(Party &party, const BeaverTriplet &bt, const uint32_t x, const uint32_t y) const {
+    uint32_t z;
+    // Calculate the own shares of the differences de.
+    std::array<uint32_t, 2> de{utils::Mod(x - bt.a, this->bitsize_), utils::Mod(y - bt.b, this->bitsize_)};
+    // Open the differences de in place.
+    Reconst(party, de);
     // Calculate the secure multiplication result based on party_id.
     if (party.GetId() == 0) {
         z = utils::Mod((de[1] * bt.a) + (de[0] * bt.b) + bt.c + (de[0] * de[1]), this->bitsize_);
@@ -231,56 +622,209 @@ uint32_t AdditiveSecretSharing::Mult(Party &party, const BeaverTriplet &bt, cons
 }
 
 std::array<uint32_t, 2> AdditiveSecretSharing::Mult2(Party &party, const BeaverTriplet &bt1, const BeaverTriplet &bt2, const uint32_t x1, const uint32_t y1, const uint32_t x2, const uint32_t y2) const {
-    std::array<uint32_t, 2> z;
-    std::array<uint32_t, 4> de{0, 0, 0, 0}, de_0{0, 0, 0, 0}, de_1{0, 0, 0, 0};
-    // Calculate the differences de_0 and de_1 based on party_id.
-    if (party.GetId() == 0) {
-        de_0[0] = utils::Mod(x1 - bt1.a, this->bitsize_);
-        de_0[1] = utils::Mod(y1 - bt1.b, this->bitsize_);
-        de_0[2] = utils::Mod(x2 - bt2.a, this->bitsize_);
-        de_0[3] = utils::Mod(y2 - bt2.b, this->bitsize_);
-    } else {
-        de_1[0] = utils::Mod(x1 - bt1.a, this->bitsize_);
-        de_1[1] = utils::Mod(y1 - bt1.b, this->bitsize_);
-        de_1[2] = utils::Mod(x2 - bt2.a, this->bitsize_);
-        de_1[3] = utils::Mod(y2 - bt2.b, this->bitsize_);
-    }
-    // Calculate the final differences de based on de_0 and de_1.
-    Reconst(party, de_0, de_1, de);
-    // Calculate the secure multiplication result based on party_id.
-    if (party.GetId() == 0) {
-        z[0] = utils::Mod((de[1] * bt1.a) + (de[0] * bt1.b) + bt1.c + (de[0] * de[1]), this->bitsize_);
-        z[1] = utils::Mod((de[3] * bt2.a) + (de[2] * bt2.b) + bt2.c + (de[2] * de[3]), this->bitsize_);
-    } else {
-        z[0] = utils::Mod((de[1] * bt1.a) + (de[0] * bt1.b) + bt1.c, this->bitsize_);
-        z[1] = utils::Mod((de[3] * bt2.a) + (de[2] * bt2.b) + bt2.c, this->bitsize_);
-    }
-    return z;
+    return MultN<2>(party, {bt1, bt2}, {x1, x2}, {y1, y2});
 }
 
 void AdditiveSecretSharing::Mult(Party &party, const bts_t &bt_vec, const std::vector<uint32_t> &x_vec, const std::vector<uint32_t> &y_vec, std::vector<uint32_t> &z_vec) const {
-    size_t                num = z_vec.size();
-    std::vector<uint32_t> de_vec(num * 2), de_vec_0(num * 2), de_vec_1(num * 2);
-    for (size_t i = 0; i < num; i++) {
-        // Calculate the differences de_0 and de_1 based on party_id.
-        if (party.GetId() == 0) {
-            de_vec_0[2 * i]     = utils::Mod(x_vec[i] - bt_vec[i].a, this->bitsize_);
-            de_vec_0[2 * i + 1] = utils::Mod(y_vec[i] - bt_vec[i].b, this->bitsize_);
-        } else {
-            de_vec_1[2 * i]     = utils::Mod(x_vec[i] - bt_vec[i].a, this->bitsize_);
-            de_vec_1[2 * i + 1] = utils::Mod(y_vec[i] - bt_vec[i].b, this->bitsize_);
+    size_t                  num  = z_vec.size();
+    utils::ThreadPool      &pool = party.GetThreadPool();
+    utils::Workspace::Frame frame(party.GetWorkspace());
+    // Own masked differences and those received from the other party
+    uint32_t *de_own   = party.GetWorkspace().Allocate(num * 2);
+    uint32_t *de_other = party.GetWorkspace().Allocate(num * 2);
+    pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            de_own[2 * i]     = utils::Mod(x_vec[i] - bt_vec[i].a, this->bitsize_);
+            de_own[2 * i + 1] = utils::Mod(y_vec[i] - bt_vec[i].b, this->bitsize_);
         }
+    });
+    // Exchange the differences with the other party.
+    party.Exchange(utils::Span<const uint32_t>(de_own, num * 2), utils::Span<uint32_t>(de_other, num * 2));
+    DispatchByRole(party, [&](auto is_party_0) {
+        pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                // Calculate the final differences de from the own and received shares.
+                uint32_t d = utils::Mod(de_own[2 * i] + de_other[2 * i], this->bitsize_);
+                uint32_t e = utils::Mod(de_own[2 * i + 1] + de_other[2 * i + 1], this->bitsize_);
+                // Calculate the secure multiplication result; only party 0 adds the public term d * e.
+                if constexpr (decltype(is_party_0)::value) {
+                    z_vec[i] = utils::Mod((e * bt_vec[i].a) + (d * bt_vec[i].b) + bt_vec[i].c + (d * e), this->bitsize_);
+                } else {
+                    z_vec[i] = utils::Mod((e * bt_vec[i].a) + (d * bt_vec[i].b) + bt_vec[i].c, this->bitsize_);
+                }
+            }
+        });
+    });
+}
+
+void AdditiveSecretSharing::MultBroadcast(Party &party, const BroadcastBeaverTriplets &bbt, const uint32_t x, const std::vector<uint32_t> &y_vec, std::vector<uint32_t> &z_vec) const {
+    if (bbt.b_vec.size() < y_vec.size() || bbt.c_vec.size() < y_vec.size()) {
+        throw std::invalid_argument("Not enough broadcast Beaver triples for the values.");
     }
-    // Calculate the final differences de based on de_0 and de_1.
-    Reconst(party, de_vec_0, de_vec_1, de_vec);
-    for (size_t i = 0; i < num; i++) {
-        // Calculate the secure multiplication result based on party_id.
-        if (party.GetId() == 0) {
-            z_vec[i] = utils::Mod((de_vec[2 * i + 1] * bt_vec[i].a) + (de_vec[2 * i] * bt_vec[i].b) + bt_vec[i].c + (de_vec[2 * i] * de_vec[2 * i + 1]), this->bitsize_);
-        } else {
-            z_vec[i] = utils::Mod((de_vec[2 * i + 1] * bt_vec[i].a) + (de_vec[2 * i] * bt_vec[i].b) + bt_vec[i].c, this->bitsize_);
+    size_t                  num  = y_vec.size();
+    utils::ThreadPool      &pool = party.GetThreadPool();
+    utils::Workspace::Frame frame(party.GetWorkspace());
+    // Own masked differences [d, e_0, ..., e_{n-1}] and those received from the other party
+    uint32_t *de_own   = party.GetWorkspace().Allocate(num + 1);
+    uint32_t *de_other = party.GetWorkspace().Allocate(num + 1);
+    de_own[0]          = utils::Mod(x - bbt.a, this->bitsize_);
+    pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            de_own[i + 1] = utils::Mod(y_vec[i] - bbt.b_vec[i], this->bitsize_);
+        }
+    });
+    // Exchange the differences with the other party.
+    party.Exchange(utils::Span<const uint32_t>(de_own, num + 1), utils::Span<uint32_t>(de_other, num + 1));
+    const uint32_t d = utils::Mod(de_own[0] + de_other[0], this->bitsize_);
+    z_vec.resize(num);
+    DispatchByRole(party, [&](auto is_party_0) {
+        pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                uint32_t e = utils::Mod(de_own[i + 1] + de_other[i + 1], this->bitsize_);
+                // Calculate the secure multiplication result; only party 0 adds the public term d * e.
+                if constexpr (decltype(is_party_0)::value) {
+                    z_vec[i] = utils::Mod((e * bbt.a) + (d * bbt.b_vec[i]) + bbt.c_vec[i] + (d * e), this->bitsize_);
+                } else {
+                    z_vec[i] = utils::Mod((e * bbt.a) + (d * bbt.b_vec[i]) + bbt.c_vec[i], this->bitsize_);
+                }
+            }
+        });
+    });
+}
+
+uint32_t AdditiveSecretSharing::Square(Party &party, const SquarePair &sp, const uint32_t x) const {
+    // Open the difference d = x - a in place.
+    std::array<uint32_t, 1> d{utils::Mod(x - sp.a, this->bitsize_)};
+    Reconst(party, d);
+    // x^2 = d^2 + 2 * d * a + a^2, where only party 0 adds the public term d^2.
+    return utils::Mod((2 * d[0] * sp.a) + sp.aa + ((party.GetId() == 0) ? d[0] * d[0] : 0U), this->bitsize_);
+}
+
+void AdditiveSecretSharing::Square(Party &party, const sps_t &sp_vec, const std::vector<uint32_t> &x_vec, std::vector<uint32_t> &z_vec) const {
+    if (sp_vec.size() < x_vec.size()) {
+        throw std::invalid_argument("Not enough square pairs for the values.");
+    }
+    size_t                  num  = x_vec.size();
+    utils::ThreadPool      &pool = party.GetThreadPool();
+    utils::Workspace::Frame frame(party.GetWorkspace());
+    // Own masked differences and those received from the other party
+    uint32_t *d_own   = party.GetWorkspace().Allocate(num);
+    uint32_t *d_other = party.GetWorkspace().Allocate(num);
+    pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            d_own[i] = utils::Mod(x_vec[i] - sp_vec[i].a, this->bitsize_);
+        }
+    });
+    // Exchange the differences with the other party.
+    party.Exchange(utils::Span<const uint32_t>(d_own, num), utils::Span<uint32_t>(d_other, num));
+    z_vec.resize(num);
+    DispatchByRole(party, [&](auto is_party_0) {
+        pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                uint32_t d = utils::Mod(d_own[i] + d_other[i], this->bitsize_);
+                // Calculate the secure squaring result; only party 0 adds the public term d^2.
+                if constexpr (decltype(is_party_0)::value) {
+                    z_vec[i] = utils::Mod((2 * d * sp_vec[i].a) + sp_vec[i].aa + (d * d), this->bitsize_);
+                } else {
+                    z_vec[i] = utils::Mod((2 * d * sp_vec[i].a) + sp_vec[i].aa, this->bitsize_);
+                }
+            }
+        });
+    });
+}
+
+void AdditiveSecretSharing::EvalPolynomial(Party &party, const PowerTuples &pt, const std::vector<uint32_t> &coeffs, const std::vector<uint32_t> &x_vec, std::vector<uint32_t> &z_vec) const {
+    if (pt.degree == 0 || coeffs.empty() || coeffs.size() - 1 > pt.degree) {
+        throw std::invalid_argument("The degree of the polynomial must not exceed the degree of the power tuples.");
+    }
+    if (pt.num < x_vec.size() || pt.powers.size() != static_cast<size_t>(pt.num) * pt.degree) {
+        throw std::invalid_argument("Not enough power tuples for the values, or the powers do not match 'num' and 'degree'.");
+    }
+    size_t                  num    = x_vec.size();
+    size_t                  degree = coeffs.size() - 1;
+    utils::ThreadPool      &pool   = party.GetThreadPool();
+    utils::Workspace::Frame frame(party.GetWorkspace());
+    // Table cb[m * (k + 1) + j] = c_j * C(j, m), so that p(d + r) = sum_m r^m * sum_{j >= m} cb[m][j] * d^(j - m)
+    uint32_t *cb = party.GetWorkspace().Allocate((degree + 1) * (degree + 1));
+    for (size_t j = 0; j <= degree; j++) {
+        uint64_t binom = 1;    // C(j, m), exact for the small degrees used in practice
+        for (size_t m = 0; m <= j; m++) {
+            cb[m * (degree + 1) + j] = coeffs[j] * static_cast<uint32_t>(binom);
+            binom                    = binom * (j - m) / (m + 1);
         }
     }
+    // Own masked differences and those received from the other party
+    uint32_t *d_own   = party.GetWorkspace().Allocate(num);
+    uint32_t *d_other = party.GetWorkspace().Allocate(num);
+    pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            d_own[i] = utils::Mod(x_vec[i] - pt.powers[i * pt.degree], this->bitsize_);
+        }
+    });
+    // Exchange the differences with the other party.
+    party.Exchange(utils::Span<const uint32_t>(d_own, num), utils::Span<uint32_t>(d_other, num));
+    z_vec.resize(num);
+    DispatchByRole(party, [&](auto is_party_0) {
+        pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                const uint32_t  d      = utils::Mod(d_own[i] + d_other[i], this->bitsize_);
+                const uint32_t *r_pows = pt.powers.data() + i * pt.degree;
+                uint32_t        z      = 0;
+                for (size_t m = (decltype(is_party_0)::value ? 0 : 1); m <= degree; m++) {
+                    // w_m = sum_{j >= m} c_j * C(j, m) * d^(j - m) by Horner's rule
+                    const uint32_t *cb_m = cb + m * (degree + 1);
+                    uint32_t        w_m  = 0;
+                    for (size_t j = degree + 1; j-- > m;) {
+                        w_m = w_m * d + cb_m[j];
+                    }
+                    // Only party 0 adds the public term w_0 (r^0 = 1).
+                    z += (m == 0) ? w_m : w_m * r_pows[m - 1];
+                }
+                z_vec[i] = utils::Mod(z, this->bitsize_);
+            }
+        });
+    });
+}
+
+uint32_t AdditiveSecretSharing::Select(Party &party, const BeaverTriplet &bt, const uint32_t b, const uint32_t x, const uint32_t y) const {
+    // b ? x : y = y + b * (x - y)
+    return utils::Mod(this->Mult(party, bt, b, x - y) + y, this->bitsize_);
+}
+
+void AdditiveSecretSharing::Select(Party &party, const bts_t &bt_vec, const std::vector<uint32_t> &b_vec, const std::vector<uint32_t> &x_vec, const std::vector<uint32_t> &y_vec, std::vector<uint32_t> &z_vec) const {
+    z_vec.resize(b_vec.size());
+    this->Select(party, utils::Span<const BeaverTriplet>(bt_vec), utils::Span<const uint32_t>(b_vec), utils::Span<const uint32_t>(x_vec), utils::Span<const uint32_t>(y_vec), utils::Span<uint32_t>(z_vec));
+}
+
+void AdditiveSecretSharing::Select(Party &party, utils::Span<const BeaverTriplet> bt_vec, utils::Span<const uint32_t> b_vec, utils::Span<const uint32_t> x_vec, utils::Span<const uint32_t> y_vec, utils::Span<uint32_t> z_vec) const {
+    size_t                  num  = z_vec.size();
+    utils::ThreadPool      &pool = party.GetThreadPool();
+    utils::Workspace::Frame frame(party.GetWorkspace());
+    // Own masked differences of b and x - y and those received from the other party
+    uint32_t *de_own   = party.GetWorkspace().Allocate(num * 2);
+    uint32_t *de_other = party.GetWorkspace().Allocate(num * 2);
+    pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            de_own[2 * i]     = utils::Mod(b_vec[i] - bt_vec[i].a, this->bitsize_);
+            de_own[2 * i + 1] = utils::Mod(x_vec[i] - y_vec[i] - bt_vec[i].b, this->bitsize_);
+        }
+    });
+    // Exchange the differences with the other party.
+    party.Exchange(utils::Span<const uint32_t>(de_own, num * 2), utils::Span<uint32_t>(de_other, num * 2));
+    DispatchByRole(party, [&](auto is_party_0) {
+        pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                uint32_t d = utils::Mod(de_own[2 * i] + de_other[2 * i], this->bitsize_);
+                uint32_t e = utils::Mod(de_own[2 * i + 1] + de_other[2 * i + 1], this->bitsize_);
+                // y + b * (x - y); only party 0 adds the public term d * e.
+                if constexpr (decltype(is_party_0)::value) {
+                    z_vec[i] = utils::Mod((e * bt_vec[i].a) + (d * bt_vec[i].b) + bt_vec[i].c + (d * e) + y_vec[i], this->bitsize_);
+                } else {
+                    z_vec[i] = utils::Mod((e * bt_vec[i].a) + (d * bt_vec[i].b) + bt_vec[i].c + y_vec[i], this->bitsize_);
+                }
+            }
+        });
+    });
 }
 
 share_t BooleanSecretSharing::Share(const uint32_t x) const {
@@ -308,17 +852,78 @@ shares_t BooleanSecretSharing::Share(const std::vector<uint32_t> &x_vec) const {
     return std::make_pair(x_vec_0, x_vec_1);
 }
 
-void BooleanSecretSharing::Reconst(Party &party, std::vector<uint32_t> &x_vec_0, std::vector<uint32_t> &x_vec_1, std::vector<uint32_t> &output) const {
-    size_t length = output.size();
-    party.SendRecv(x_vec_0, x_vec_1);
+shares_t BooleanSecretSharing::Share(const std::vector<uint32_t> &x_vec, utils::ThreadPool &pool) const {
+    size_t                   length = x_vec.size();
+    std::vector<uint32_t>    x_vec_0(length);
+    std::vector<uint32_t>    x_vec_1(length);
+    std::vector<rng::seed_t> seeds = GenerateChunkSeeds(pool.GetNumChunks(length));
+    pool.ParallelFor(length, [&](const uint32_t chunk_id, const size_t begin, const size_t end) {
+        rng::Prg(seeds[chunk_id]).Fill(x_vec_0.data() + begin, end - begin);
+        for (size_t i = begin; i < end; i++) {
+            x_vec_0[i] &= 1U;
+            x_vec_1[i] = x_vec[i] ^ x_vec_0[i];
+        }
+    });
+    return std::make_pair(x_vec_0, x_vec_1);
+}
+
+seeded_shares_t BooleanSecretSharing::ShareWithSeed(const std::vector<uint32_t> &x_vec) const {
+    size_t                length = x_vec.size();
+    ShareSeed             x_seed{rng::Prg::GenerateSeed(), static_cast<uint32_t>(length)};
+    std::vector<uint32_t> x_vec_1(length);
+    // x_1 = x ^ PRG(seed)
+    rng::Prg(x_seed.seed).Fill(x_vec_1.data(), length);
     for (size_t i = 0; i < length; i++) {
-        output[i] = x_vec_0[i] ^ x_vec_1[i];
+        x_vec_1[i] = x_vec[i] ^ (x_vec_1[i] & 1U);
+    }
+    return std::make_pair(x_seed, x_vec_1);
+}
+
+void BooleanSecretSharing::ExpandShare(const ShareSeed &x_seed, std::vector<uint32_t> &x_vec_0) const {
+    x_vec_0.resize(x_seed.length);
+    rng::Prg(x_seed.seed).Fill(x_vec_0.data(), x_seed.length);
+    for (size_t i = 0; i < x_seed.length; i++) {
+        x_vec_0[i] &= 1U;
+    }
+}
+
+void BooleanSecretSharing::RandomShares(Party &party, const uint32_t num, std::vector<uint32_t> &r_vec) const {
+    r_vec.resize(num);
+    party.GetOwnPrg().Fill(r_vec.data(), num);
+    for (size_t i = 0; i < num; i++) {
+        r_vec[i] &= 1U;
+    }
+}
+
+void BooleanSecretSharing::ZeroShares(Party &party, const uint32_t num, std::vector<uint32_t> &z_vec) const {
+    z_vec.resize(num);
+    party.GetCommonPrg().Fill(z_vec.data(), num);
+    for (size_t i = 0; i < num; i++) {
+        z_vec[i] &= 1U;
     }
 }
 
+void BooleanSecretSharing::Reconst(Party &party, std::vector<uint32_t> &x_vec_0, std::vector<uint32_t> &x_vec_1, std::vector<uint32_t> &output) const {
+    size_t                       length = output.size();
+    const std::vector<uint32_t> &x_own  = (party.GetId() == 0) ? x_vec_0 : x_vec_1;
+    // Receive the peer shares into the workspace instead of the caller's vector
+    utils::Workspace::Frame frame(party.GetWorkspace());
+    utils::Span<uint32_t>   x_peer(party.GetWorkspace().Allocate(x_own.size()), x_own.size());
+    party.Exchange(x_own, x_peer);
+    party.GetThreadPool().ParallelFor(length, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            output[i] = x_own[i] ^ x_peer[i];
+        }
+    });
+}
+
 void BooleanSecretSharing::Reconst(Party &party, std::array<uint32_t, 2> &x_arr_0, std::array<uint32_t, 2> &x_arr_1, std::array<uint32_t, 2> &output) const {
     size_t length = output.size();
-    party.SendRecv(x_arr_0, x_arr_1);
+    if (party.GetId() == 0) {
+        party.Exchange(x_arr_0, x_arr_1);
+    } else {
+        party.Exchange(x_arr_1, x_arr_0);
+    }
     for (size_t i = 0; i < length; i++) {
         output[i] = x_arr_0[i] ^ x_arr_1[i];
     }
@@ -326,12 +931,60 @@ void BooleanSecretSharing::Reconst(Party &party, std::array<uint32_t, 2> &x_arr_
 
 void BooleanSecretSharing::Reconst(Party &party, std::array<uint32_t, 4> &x_arr_0, std::array<uint32_t, 4> &x_arr_1, std::array<uint32_t, 4> &output) const {
     size_t length = output.size();
-    party.SendRecv(x_arr_0, x_arr_1);
+    if (party.GetId() == 0) {
+        party.Exchange(x_arr_0, x_arr_1);
+    } else {
+        party.Exchange(x_arr_1, x_arr_0);
+    }
     for (size_t i = 0; i < length; i++) {
         output[i] = x_arr_0[i] ^ x_arr_1[i];
     }
 }
 
+void BooleanSecretSharing::Reconst(Party &party, utils::Span<uint32_t> x_sh) const {
+    size_t                  length = x_sh.size();
+    utils::Workspace::Frame frame(party.GetWorkspace());
+    utils::Span<uint32_t>   x_peer(party.GetWorkspace().Allocate(length), length);
+    party.Exchange(x_sh, x_peer);
+    party.GetThreadPool().ParallelFor(length, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            x_sh[i] = x_sh[i] ^ x_peer[i];
+        }
+    });
+}
+
+uint32_t BooleanSecretSharing::RevealTo(Party &party, const uint32_t party_id, const uint32_t x_sh) const {
+    if (party_id > 1) {
+        throw std::invalid_argument("The party ID must be 0 or 1.");
+    }
+    if (party.GetId() != party_id) {
+        party.Send(utils::Span<const uint32_t>(&x_sh, 1));
+        return 0;
+    }
+    uint32_t x_peer = 0;
+    party.Recv(utils::Span<uint32_t>(&x_peer, 1));
+    return x_sh ^ x_peer;
+}
+
+void BooleanSecretSharing::RevealTo(Party &party, const uint32_t party_id, utils::Span<uint32_t> x_sh) const {
+    if (party_id > 1) {
+        throw std::invalid_argument("The party ID must be 0 or 1.");
+    }
+    if (party.GetId() != party_id) {
+        party.Send(x_sh);
+        return;
+    }
+    size_t                  length = x_sh.size();
+    utils::Workspace::Frame frame(party.GetWorkspace());
+    utils::Span<uint32_t>   x_peer(party.GetWorkspace().Allocate(length), length);
+    party.Recv(x_peer);
+    party.GetThreadPool().ParallelFor(length, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            x_sh[i] = x_sh[i] ^ x_peer[i];
+        }
+    });
+}
+
 void BooleanSecretSharing::GenerateBeaverTriples(const uint32_t bt_num, bts_t &bt_vec) const {
     for (uint32_t i = 0; i < bt_num; i++) {
         uint32_t val_a = rng::SecureRng::RandBool();
@@ -355,19 +1008,109 @@ std::pair<bts_t, bts_t> BooleanSecretSharing::ShareBeaverTriples(const bts_t &bt
     return std::make_pair(bt_vec_0, bt_vec_1);
 }
 
-uint32_t BooleanSecretSharing::And(Party &party, const BeaverTriplet &bt_b, const uint32_t x_b, const uint32_t y_b) const {
-    uint32_t                z_b;
-    std::array<uint32_t, 2> de{0, 0}, de_0{0, 0}, de_1{0, 0};
-    // Calculate the differences de_0 and de_1 based on party_id.
-    if (party.GetId() == 0) {
-        de_0[0] = x_b ^ bt_b.a;
-        de_0[1] = y_b ^ bt_b.b;
-    } else {
-        de_1[0] = x_b ^ bt_b.a;
-        de_1[1] = y_b ^ bt_b.b;
+std::pair<bts_t, bts_t> BooleanSecretSharing::ShareBeaverTriples(const bts_t &bt_vec, utils::ThreadPool &pool) const {
+    bts_t                    bt_vec_0(bt_vec.size());
+    bts_t                    bt_vec_1(bt_vec.size());
+    std::vector<rng::seed_t> seeds = GenerateChunkSeeds(pool.GetNumChunks(bt_vec.size()));
+    pool.ParallelFor(bt_vec.size(), [&](const uint32_t chunk_id, const size_t begin, const size_t end) {
+        std::vector<uint32_t> rand(3 * (end - begin));
+        rng::Prg(seeds[chunk_id]).Fill(rand.data(), rand.size());
+        for (size_t i = begin, j = 0; i < end; i++, j += 3) {
+            bt_vec_0[i].a = rand[j] & 1U;
+            bt_vec_1[i].a = bt_vec[i].a ^ bt_vec_0[i].a;
+            bt_vec_0[i].b = rand[j + 1] & 1U;
+            bt_vec_1[i].b = bt_vec[i].b ^ bt_vec_0[i].b;
+            bt_vec_0[i].c = rand[j + 2] & 1U;
+            bt_vec_1[i].c = bt_vec[i].c ^ bt_vec_0[i].c;
+        }
+    });
+    return std::make_pair(bt_vec_0, bt_vec_1);
+}
+
+cbts_t BooleanSecretSharing::GenerateCompressedBeaverTriples(const uint32_t bt_num) const {
+    CompressedBeaverTriplets cbt_0{0, bt_num, rng::Prg::GenerateSeed(), {}};
+    CompressedBeaverTriplets cbt_1{1, bt_num, rng::Prg::GenerateSeed(), std::vector<uint32_t>(bt_num)};
+    // Expand (a_0, b_0, c_0) from the seed of party 0 and (a_1, b_1) from the seed of party 1
+    std::vector<uint32_t> rand_0(3 * static_cast<size_t>(bt_num)), rand_1(2 * static_cast<size_t>(bt_num));
+    rng::Prg(cbt_0.seed).Fill(rand_0.data(), rand_0.size());
+    rng::Prg(cbt_1.seed).Fill(rand_1.data(), rand_1.size());
+    for (size_t i = 0; i < bt_num; i++) {
+        uint32_t val_a = (rand_0[3 * i] ^ rand_1[2 * i]) & 1U;
+        uint32_t val_b = (rand_0[3 * i + 1] ^ rand_1[2 * i + 1]) & 1U;
+        // Correction word c_1 = (a & b) ^ c_0
+        cbt_1.c_vec[i] = (val_a & val_b) ^ (rand_0[3 * i + 2] & 1U);
+    }
+    return std::make_pair(cbt_0, cbt_1);
+}
+
+void BooleanSecretSharing::ExpandBeaverTriples(const CompressedBeaverTriplets &cbt, bts_t &bt_vec) const {
+    size_t num = cbt.num;
+    if (cbt.party_id != 0 && cbt.c_vec.size() < num) {
+        throw std::invalid_argument("The compressed Beaver triples hold fewer correction words than triples.");
+    }
+    size_t                num_derived = (cbt.party_id == 0) ? 3 : 2;
+    std::vector<uint32_t> rand(num_derived * num);
+    rng::Prg(cbt.seed).Fill(rand.data(), rand.size());
+    bt_vec.resize(num);
+    for (size_t i = 0; i < num; i++) {
+        bt_vec[i].a = rand[num_derived * i] & 1U;
+        bt_vec[i].b = rand[num_derived * i + 1] & 1U;
+        bt_vec[i].c = (cbt.party_id == 0) ? (rand[num_derived * i + 2] & 1U) : cbt.c_vec[i];
+    }
+}
+
+void BooleanSecretSharing::GenerateSelectTriples(const uint32_t bt_num, bts_t &bt_vec) const {
+    bt_vec.resize(bt_num);
+    for (uint32_t i = 0; i < bt_num; i++) {
+        uint32_t val_a = rng::SecureRng::RandBool();
+        uint32_t val_b = rng::SecureRng::Rand32();
+        bt_vec[i]      = BeaverTriplet(val_a, val_b, (0U - val_a) & val_b);
+    }
+}
+
+std::pair<bts_t, bts_t> BooleanSecretSharing::ShareSelectTriples(const bts_t &bt_vec) const {
+    bts_t bt_vec_0(bt_vec.size());
+    bts_t bt_vec_1(bt_vec.size());
+    for (size_t i = 0; i < bt_vec.size(); i++) {
+        bt_vec_0[i].a = rng::SecureRng::RandBool();
+        bt_vec_1[i].a = bt_vec[i].a ^ bt_vec_0[i].a;
+        bt_vec_0[i].b = rng::SecureRng::Rand32();
+        bt_vec_1[i].b = bt_vec[i].b ^ bt_vec_0[i].b;
+        bt_vec_0[i].c = rng::SecureRng::Rand32();
+        bt_vec_1[i].c = bt_vec[i].c ^ bt_vec_0[i].c;
+    }
+    return std::make_pair(bt_vec_0, bt_vec_1);
+}
+
+void BooleanSecretSharing::GeneratePackedBeaverTriples(const uint32_t bt_num, bts_t &bt_vec) const {
+    bt_vec.resize(bt_num);
+    for (uint32_t i = 0; i < bt_num; i++) {
+        uint32_t val_a = rng::SecureRng::Rand32();
+        uint32_t val_b = rng::SecureRng::Rand32();
+        bt_vec[i]      = BeaverTriplet(val_a, val_b, val_a & val_b);
+    }
+}
+
+std::pair<bts_t, bts_t> BooleanSecretSharing::SharePackedBeaverTriples(const bts_t &bt_vec) const {
+    bts_t bt_vec_0(bt_vec.size());
+    bts_t bt_vec_1(bt_vec.size());
+    for (size_t i = 0; i < bt_vec.size(); i++) {
+        bt_vec_0[i].a = rng::SecureRng::Rand32();
+        bt_vec_1[i].a = bt_vec[i].a ^ bt_vec_0[i].a;
+        bt_vec_0[i].b = rng::SecureRng::Rand32();
+        bt_vec_1[i].b = bt_vec[i].b ^ bt_vec_0[i].b;
+        bt_vec_0[i].c = rng::SecureRng::Rand32();
+        bt_vec_1[i].c = bt_vec[i].c ^ bt_vec_0[i].c;
     }
-    // Calculate the final differences de based on de_0 and de_1.
-    Reconst(party, de_0, de_1, de);
+    return std::make_pair(bt_vec_0, bt_vec_1);
+}
+
+uint32_t BooleanSecretSharing::And(Party &party, const BeaverTriplet &bt_b, const uint32_t x_b, const uint32_t y_b) const {
+    uint32_t z_b;
+    // Calculate the own shares of the differences de.
+    std::array<uint32_t, 2> de{x_b ^ bt_b.a, y_b ^ bt_b.b};
+    // Open the differences de in place.
+    Reconst(party, de);
     // Calculate the secure multiplication result based on party_id.
     if (party.GetId() == 0) {
         z_b = (de[1] & bt_b.a) ^ (de[0] & bt_b.b) ^ bt_b.c ^ (de[0] & de[1]);
@@ -378,28 +1121,39 @@ uint32_t BooleanSecretSharing::And(Party &party, const BeaverTriplet &bt_b, cons
 }
 
 void BooleanSecretSharing::And(Party &party, const bts_t &btb_vec, const std::vector<uint32_t> &xb_vec, const std::vector<uint32_t> &yb_vec, std::vector<uint32_t> &zb_vec) const {
-    size_t                num = zb_vec.size();
-    std::vector<uint32_t> de_vec(num * 2), de_vec_0(num * 2), de_vec_1(num * 2);
-    for (size_t i = 0; i < num; i++) {
-        // Calculate the differences de_0 and de_1 based on party_id.
-        if (party.GetId() == 0) {
-            de_vec_0[2 * i]     = xb_vec[i] ^ btb_vec[i].a;
-            de_vec_0[2 * i + 1] = yb_vec[i] ^ btb_vec[i].b;
-        } else {
-            de_vec_1[2 * i]     = xb_vec[i] ^ btb_vec[i].a;
-            de_vec_1[2 * i + 1] = yb_vec[i] ^ btb_vec[i].b;
-        }
-    }
-    // Calculate the final differences de based on de_0 and de_1.
-    Reconst(party, de_vec_0, de_vec_1, de_vec);
-    for (size_t i = 0; i < num; i++) {
-        // Calculate the secure multiplication result based on party_id.
-        if (party.GetId() == 0) {
-            zb_vec[i] = (de_vec[2 * i + 1] & btb_vec[i].a) ^ (de_vec[2 * i] & btb_vec[i].b) ^ btb_vec[i].c ^ (de_vec[2 * i] & de_vec[2 * i + 1]);
-        } else {
-            zb_vec[i] = (de_vec[2 * i + 1] & btb_vec[i].a) ^ (de_vec[2 * i] & btb_vec[i].b) ^ btb_vec[i].c;
+    this->And(party, utils::Span<const BeaverTriplet>(btb_vec), utils::Span<const uint32_t>(xb_vec), utils::Span<const uint32_t>(yb_vec), utils::Span<uint32_t>(zb_vec));
+}
+
+void BooleanSecretSharing::And(Party &party, utils::Span<const BeaverTriplet> btb_vec, utils::Span<const uint32_t> xb_vec, utils::Span<const uint32_t> yb_vec, utils::Span<uint32_t> zb_vec) const {
+    size_t                  num  = zb_vec.size();
+    utils::ThreadPool      &pool = party.GetThreadPool();
+    utils::Workspace::Frame frame(party.GetWorkspace());
+    // Own masked differences and those received from the other party
+    uint32_t *de_own   = party.GetWorkspace().Allocate(num * 2);
+    uint32_t *de_other = party.GetWorkspace().Allocate(num * 2);
+    pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            de_own[2 * i]     = xb_vec[i] ^ btb_vec[i].a;
+            de_own[2 * i + 1] = yb_vec[i] ^ btb_vec[i].b;
         }
-    }
+    });
+    // Exchange the differences with the other party.
+    party.Exchange(utils::Span<const uint32_t>(de_own, num * 2), utils::Span<uint32_t>(de_other, num * 2));
+    DispatchByRole(party, [&](auto is_party_0) {
+        pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                // Calculate the final differences de from the own and received shares.
+                uint32_t d = de_own[2 * i] ^ de_other[2 * i];
+                uint32_t e = de_own[2 * i + 1] ^ de_other[2 * i + 1];
+                // Calculate the secure AND result; only party 0 adds the public term d & e.
+                if constexpr (decltype(is_party_0)::value) {
+                    zb_vec[i] = (e & btb_vec[i].a) ^ (d & btb_vec[i].b) ^ btb_vec[i].c ^ (d & e);
+                } else {
+                    zb_vec[i] = (e & btb_vec[i].a) ^ (d & btb_vec[i].b) ^ btb_vec[i].c;
+                }
+            }
+        });
+    });
 }
 
 uint32_t BooleanSecretSharing::Or(Party &party, const BeaverTriplet &bt_b, const uint32_t x_b, const uint32_t y_b) const {
@@ -417,20 +1171,122 @@ uint32_t BooleanSecretSharing::Or(Party &party, const BeaverTriplet &bt_b, const
 }
 
 void BooleanSecretSharing::Or(Party &party, const bts_t &btb_vec, const std::vector<uint32_t> &xb_vec, const std::vector<uint32_t> &yb_vec, std::vector<uint32_t> &zb_vec) const {
-    size_t                num = zb_vec.size();
-    std::vector<uint32_t> nxb_vec(num), nyb_vec(num);
-    if (party.GetId() == 0) {
-        for (size_t i = 0; i < num; i++) {
-            nxb_vec[i] = xb_vec[i] ^ 1;
-            nyb_vec[i] = yb_vec[i] ^ 1;
+    // x | y = x ^ y ^ (x & y) is linear in the AND result, so no negated copies of the inputs are needed.
+    And(party, btb_vec, xb_vec, yb_vec, zb_vec);
+    party.GetThreadPool().ParallelFor(zb_vec.size(), [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            zb_vec[i] ^= xb_vec[i] ^ yb_vec[i];
+        }
+    });
+}
+
+uint32_t BooleanSecretSharing::Select(Party &party, const BeaverTriplet &bt_s, const uint32_t b_b, const uint32_t x_b, const uint32_t y_b) const {
+    // Open the masked selector bit and the masked word x ^ y in place.
+    std::array<uint32_t, 2> de{(b_b ^ bt_s.a) & 1U, x_b ^ y_b ^ bt_s.b};
+    Reconst(party, de);
+    // Broadcast the bits to full-word masks: 0 - bit is 0 or ~0, and it commutes with XOR.
+    uint32_t d = 0U - de[0];
+    uint32_t e = de[1];
+    // y ^ (b & (x ^ y)); only party 0 adds the public term d & e.
+    return (d & bt_s.b) ^ ((0U - (bt_s.a & 1U)) & e) ^ bt_s.c ^ ((party.GetId() == 0) ? d & e : 0U) ^ y_b;
+}
+
+void BooleanSecretSharing::Select(Party &party, const bts_t &bts_vec, const std::vector<uint32_t> &bb_vec, const std::vector<uint32_t> &xb_vec, const std::vector<uint32_t> &yb_vec, std::vector<uint32_t> &zb_vec) const {
+    size_t                  num  = bb_vec.size();
+    utils::ThreadPool      &pool = party.GetThreadPool();
+    utils::Workspace::Frame frame(party.GetWorkspace());
+    // Own masked selector bits and words x ^ y, and those received from the other party
+    uint32_t *de_own   = party.GetWorkspace().Allocate(num * 2);
+    uint32_t *de_other = party.GetWorkspace().Allocate(num * 2);
+    pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            de_own[2 * i]     = (bb_vec[i] ^ bts_vec[i].a) & 1U;
+            de_own[2 * i + 1] = xb_vec[i] ^ yb_vec[i] ^ bts_vec[i].b;
         }
-        And(party, btb_vec, nxb_vec, nyb_vec, zb_vec);
-        for (size_t i = 0; i < num; i++) {
-            zb_vec[i] = zb_vec[i] ^ 1;
+    });
+    // Exchange the differences with the other party.
+    party.Exchange(utils::Span<const uint32_t>(de_own, num * 2), utils::Span<uint32_t>(de_other, num * 2));
+    zb_vec.resize(num);
+    DispatchByRole(party, [&](auto is_party_0) {
+        pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                // Broadcast the bits to full-word masks: 0 - bit is 0 or ~0, and it commutes with XOR.
+                uint32_t d = 0U - (de_own[2 * i] ^ de_other[2 * i]);
+                uint32_t e = de_own[2 * i + 1] ^ de_other[2 * i + 1];
+                // y ^ (b & (x ^ y)); only party 0 adds the public term d & e.
+                if constexpr (decltype(is_party_0)::value) {
+                    zb_vec[i] = (d & bts_vec[i].b) ^ ((0U - (bts_vec[i].a & 1U)) & e) ^ bts_vec[i].c ^ (d & e) ^ yb_vec[i];
+                } else {
+                    zb_vec[i] = (d & bts_vec[i].b) ^ ((0U - (bts_vec[i].a & 1U)) & e) ^ bts_vec[i].c ^ yb_vec[i];
+                }
+            }
+        });
+    });
+}
+
+MultBatch::MultBatch(const uint32_t bitsize)
+    : bitsize_(bitsize), num_elements_(0) {
+}
+
+void MultBatch::AddMult(utils::Span<const BeaverTriplet> bt_vec, utils::Span<const uint32_t> x_vec, utils::Span<const uint32_t> y_vec, utils::Span<uint32_t> z_vec) {
+    this->AddGroup(false, bt_vec, x_vec, y_vec, z_vec);
+}
+
+void MultBatch::AddAnd(utils::Span<const BeaverTriplet> btb_vec, utils::Span<const uint32_t> xb_vec, utils::Span<const uint32_t> yb_vec, utils::Span<uint32_t> zb_vec) {
+    this->AddGroup(true, btb_vec, xb_vec, yb_vec, zb_vec);
+}
+
+void MultBatch::AddGroup(const bool is_boolean, utils::Span<const BeaverTriplet> bt_vec, utils::Span<const uint32_t> x_vec, utils::Span<const uint32_t> y_vec, utils::Span<uint32_t> z_vec) {
+    if (x_vec.size() != z_vec.size() || y_vec.size() != z_vec.size()) {
+        throw std::invalid_argument("The sizes of the operands and the output must match.");
+    }
+    if (bt_vec.size() < z_vec.size()) {
+        throw std::invalid_argument("Not enough Beaver triples for the group.");
+    }
+    this->groups_.push_back(Group{is_boolean, bt_vec, x_vec, y_vec, z_vec, this->num_elements_});
+    this->num_elements_ += z_vec.size();
+}
+
+void MultBatch::Run(Party &party) const {
+    size_t                  num  = this->num_elements_;
+    utils::ThreadPool      &pool = party.GetThreadPool();
+    utils::Workspace::Frame frame(party.GetWorkspace());
+    // Own masked differences of all groups and those received from the other party
+    uint32_t *de_own   = party.GetWorkspace().Allocate(num * 2);
+    uint32_t *de_other = party.GetWorkspace().Allocate(num * 2);
+    // The ring of a group is fixed, so the kernel is chosen once per group
+    for (const Group &g : this->groups_) {
+        if (g.is_boolean) {
+            MaskDifferences(pool, BooleanOps{}, g.bt_vec, g.x_vec, g.y_vec, de_own + 2 * g.offset, g.z_vec.size());
+        } else {
+            MaskDifferences(pool, AdditiveOps{this->bitsize_}, g.bt_vec, g.x_vec, g.y_vec, de_own + 2 * g.offset, g.z_vec.size());
         }
-    } else {
-        And(party, btb_vec, xb_vec, yb_vec, zb_vec);
     }
+    // Exchange the differences of all groups in a single round.
+    party.Exchange(utils::Span<const uint32_t>(de_own, num * 2), utils::Span<uint32_t>(de_other, num * 2));
+    DispatchByRole(party, [&](auto is_party_0) {
+        constexpr bool kIsParty0 = decltype(is_party_0)::value;
+        for (const Group &g : this->groups_) {
+            if (g.is_boolean) {
+                CombineProducts<kIsParty0>(pool, BooleanOps{}, g.bt_vec, de_own + 2 * g.offset, de_other + 2 * g.offset, g.z_vec);
+            } else {
+                CombineProducts<kIsParty0>(pool, AdditiveOps{this->bitsize_}, g.bt_vec, de_own + 2 * g.offset, de_other + 2 * g.offset, g.z_vec);
+            }
+        }
+    });
+}
+
+void MultBatch::Clear() {
+    this->groups_.clear();
+    this->num_elements_ = 0;
+}
+
+size_t MultBatch::GetNumGroups() const {
+    return this->groups_.size();
+}
+
+size_t MultBatch::GetNumElements() const {
+    return this->num_elements_;
 }
 
 ShareHandler::ShareHandler(const bool debug, const bool io_debug, const std::string ext)
@@ -447,6 +1303,13 @@ void ShareHandler::ExportShare(const std::string &file_path_p0, const std::strin
     this->io_.WriteVectorToFile(file_path_p1, x_vec_sh.second);
 }
 
+void ShareHandler::ExportShare(const std::string &file_path_p0, const std::string &file_path_p1, seeded_shares_t &x_seed_sh) {
+    const ShareSeed      &x_seed = x_seed_sh.first;
+    std::vector<uint32_t> seed_vec{x_seed.length, x_seed.seed[0], x_seed.seed[1], x_seed.seed[2], x_seed.seed[3]};
+    this->io_.WriteVectorToFile(file_path_p0, seed_vec);
+    this->io_.WriteVectorToFile(file_path_p1, x_seed_sh.second);
+}
+
 void ShareHandler::LoadShare(const std::string &file_path, uint32_t &x_sh) {
     this->io_.ReadValueFromFile(file_path, x_sh);
 }
@@ -455,6 +1318,17 @@ void ShareHandler::LoadShare(const std::string &file_path, std::vector<uint32_t>
     this->io_.ReadVectorFromFile(file_path, x_vec_sh);
 }
 
+void ShareHandler::LoadShare(const std::string &file_path, ShareSeed &x_seed) {
+    std::vector<uint32_t> seed_vec;
+    this->io_.ReadVectorFromFile(file_path, seed_vec);
+    if (seed_vec.size() != 1 + x_seed.seed.size()) {
+        utils::Logger::ErrorLog(LOCATION, "Invalid file format: Unable to read the share seed (" + file_path + ")");
+        return;
+    }
+    x_seed.length = seed_vec[0];
+    std::copy(seed_vec.begin() + 1, seed_vec.end(), x_seed.seed.begin());
+}
+
 void ShareHandler::ExportBT(const std::string &file_path, bts_t &bt_vec) {
     this->WriteBeaverTriplesToFile(file_path, bt_vec);
 }
@@ -468,6 +1342,24 @@ void ShareHandler::LoadBTShare(const std::string &file_path, bts_t &bt_vec_sh) {
     this->ReadBeaverTriplesFromFile(file_path, bt_vec_sh);
 }
 
+void ShareHandler::ExportBTShare(const std::string &file_path_p0, const std::string &file_path_p1, cbts_t &cbt_sh) {
+    this->WriteCompressedBeaverTriplesToFile(file_path_p0, cbt_sh.first);
+    this->WriteCompressedBeaverTriplesToFile(file_path_p1, cbt_sh.second);
+}
+
+void ShareHandler::LoadBTShare(const std::string &file_path, CompressedBeaverTriplets &cbt_sh) {
+    this->ReadCompressedBeaverTriplesFromFile(file_path, cbt_sh);
+}
+
+void ShareHandler::ExportSPShare(const std::string &file_path_p0, const std::string &file_path_p1, std::pair<sps_t, sps_t> &sp_vec_sh) {
+    this->WriteSquarePairsToFile(file_path_p0, sp_vec_sh.first);
+    this->WriteSquarePairsToFile(file_path_p1, sp_vec_sh.second);
+}
+
+void ShareHandler::LoadSPShare(const std::string &file_path, sps_t &sp_vec_sh) {
+    this->ReadSquarePairsFromFile(file_path, sp_vec_sh);
+}
+
 void ShareHandler::WriteBeaverTriplesToFile(const std::string &file_path, bts_t &bt_vec) {
     // Open the file
     std::ofstream file;
@@ -505,5 +1397,101 @@ void ShareHandler::ReadBeaverTriplesFromFile(const std::string &file_path, bts_t
     }
 }
 
+void ShareHandler::WriteCompressedBeaverTriplesToFile(const std::string &file_path, CompressedBeaverTriplets &cbt) {
+    // Open the file
+    std::ofstream file;
+    if (!this->io_.OpenFile(file, file_path, LOCATION)) {
+        exit(EXIT_FAILURE);
+    }
+    // Write the header (party ID and number of triples) and the seed
+    file << cbt.party_id << "," << cbt.num << "\n";
+    file << cbt.seed[0] << "," << cbt.seed[1] << "," << cbt.seed[2] << "," << cbt.seed[3] << "\n";
+    // Write the correction words (party 1 only)
+    for (size_t i = 0; i < cbt.c_vec.size(); i++) {
+        file << cbt.c_vec[i];
+        if (i < cbt.c_vec.size() - 1) {
+            file << ",";
+        }
+    }
+    file << "\n";
+    // Close the file
+    file.close();
+}
+
+void ShareHandler::ReadCompressedBeaverTriplesFromFile(const std::string &file_path, CompressedBeaverTriplets &cbt) {
+    // Open the file
+    std::ifstream file;
+    if (this->io_.OpenFile(file, file_path, LOCATION)) {
+        std::string              line;
+        std::vector<uint32_t>    header, seed;
+        CompressedBeaverTriplets cbts{};
+        // Read the header and the seed
+        if (std::getline(file, line)) {
+            this->io_.SplitStringToUint32(line, header);
+        }
+        if (std::getline(file, line)) {
+            this->io_.SplitStringToUint32(line, seed);
+        }
+        if (header.size() != 2 || seed.size() != cbts.seed.size()) {
+            utils::Logger::ErrorLog(LOCATION, "Invalid file format: Unable to read the compressed Beaver triples (" + file_path + ")");
+            file.close();
+            return;
+        }
+        cbts.party_id = header[0];
+        cbts.num      = header[1];
+        std::copy(seed.begin(), seed.end(), cbts.seed.begin());
+        // Read the correction words (party 1 only)
+        if (cbts.party_id != 0 && std::getline(file, line)) {
+            cbts.c_vec.reserve(cbts.num);
+            this->io_.SplitStringToUint32(line, cbts.c_vec);
+        }
+        if (cbts.party_id != 0 && cbts.c_vec.size() != cbts.num) {
+            utils::Logger::ErrorLog(LOCATION, "Invalid file format: The number of correction words does not match the number of Beaver triples (" + file_path + ")");
+            file.close();
+            return;
+        }
+        // Close the file
+        file.close();
+        cbt = std::move(cbts);
+    }
+}
+
+void ShareHandler::WriteSquarePairsToFile(const std::string &file_path, sps_t &sp_vec) {
+    // Open the file
+    std::ofstream file;
+    if (!this->io_.OpenFile(file, file_path, LOCATION)) {
+        exit(EXIT_FAILURE);
+    }
+    // Write the square pairs to the file
+    file << sp_vec.size() << "\n";
+    for (size_t i = 0; i < sp_vec.size(); i++) {
+        file << sp_vec[i].a << "," << sp_vec[i].aa << "\n";
+    }
+    // Close the file
+    file.close();
+}
+
+void ShareHandler::ReadSquarePairsFromFile(const std::string &file_path, sps_t &sp_vec) {
+    // Open the file
+    std::ifstream file;
+    if (this->io_.OpenFile(file, file_path, LOCATION)) {
+        // Read the number of elements from the first line of the file
+        uint32_t size = this->io_.ReadNumCountFromFile(file, LOCATION);
+        sps_t    sps;
+        sps.reserve(size);
+        for (uint32_t i = 0; i < size; i++) {
+            std::string line;
+            if (std::getline(file, line)) {
+                std::vector<uint32_t> vec;
+                io_.SplitStringToUint32(line, vec);
+                sps.push_back(SquarePair{vec[0], vec[1]});
+            }
+        }
+        // Close the file
+        file.close();
+        sp_vec = std::move(sps);
+    }
+}
+
 }    // namespace secret_sharing
 }    // namespace tools
@@ -3,6 +3,7 @@
 
 #include <array>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -11,6 +12,11 @@
 #include "../comm/comm.hpp"
 #include "../comm/server.hpp"
 #include "../utils/file_io.hpp"
+#include "../utils/span.hpp"
+#include "../utils/thread_pool.hpp"
+#include "../utils/utils.hpp"
+#include "../utils/workspace.hpp"
+#include "random_number_generator.hpp"
 
 namespace tools {
 namespace secret_sharing {
@@ -18,6 +24,19 @@ namespace secret_sharing {
 using share_t  = std::pair<uint32_t, uint32_t>;
 using shares_t = std::pair<std::vector<uint32_t>, std::vector<uint32_t>>;
 
+/**
+ * @brief Seed of a share vector that is expanded on demand.
+ */
+struct ShareSeed {
+    rng::seed_t seed;   /**< PRG seed of the share vector. */
+    uint32_t    length; /**< Number of elements of the share vector. */
+};
+
+/**
+ * @brief Seed-expanded shares: party 0 holds only a seed, party 1 holds the masked vector.
+ */
+using seeded_shares_t = std::pair<ShareSeed, std::vector<uint32_t>>;
+
 class Party {
 public:
     /**
@@ -33,7 +52,8 @@ public:
      * @brief Initiates communication setup for the Party object.
      *
      * This method initializes the communication setup for the Party object based on its ID.
-     * It starts the communication between server and client.
+     * It starts the communication between server and client, and agrees on the PRG seeds
+     * used for pseudorandom secret sharing (see GetCommonPrg and GetOwnPrg).
      *
      */
     void StartCommunication(const bool debug = false);
@@ -54,6 +74,48 @@ public:
      */
     uint32_t GetId() const;
 
+    /**
+     * @brief Sets the number of threads used for the local phases of batched operations.
+     *
+     * Batched share operations executed by this party (e.g. Reconst, Mult and And on vectors)
+     * split their local computation across the party's thread pool. The default is a single thread.
+     *
+     * @param num_threads The number of threads including the calling thread.
+     */
+    void SetNumThreads(const uint32_t num_threads);
+
+    /**
+     * @brief Gets the number of threads used for the local phases of batched operations.
+     */
+    uint32_t GetNumThreads() const;
+
+    /**
+     * @brief Gets the thread pool used for the local phases of batched operations.
+     */
+    utils::ThreadPool &GetThreadPool() const;
+
+    /**
+     * @brief Gets the scratch-buffer arena for the temporaries of batched operations.
+     *
+     * Batched share operations draw their temporaries from this arena inside a
+     * utils::Workspace::Frame, so repeated calls do not allocate heap memory.
+     */
+    utils::Workspace &GetWorkspace() const;
+
+    /**
+     * @brief Gets the PRG whose seed is shared by both parties.
+     *
+     * The seed is the XOR of one fresh seed from each party, agreed once in StartCommunication.
+     * Both parties draw the same stream, so calls that use it must be made in the same order
+     * by both parties.
+     */
+    rng::Prg &GetCommonPrg() const;
+
+    /**
+     * @brief Gets the PRG whose seed is known only to this party.
+     */
+    rng::Prg &GetOwnPrg() const;
+
     /**
      * @brief Sends and receives data between the two parties.
      *
@@ -97,6 +159,33 @@ public:
      */
     void SendRecv(std::array<uint32_t, 4> &x_arr_0, std::array<uint32_t, 4> &x_arr_1);
 
+    /**
+     * @brief Exchanges buffers of data between the two parties.
+     *
+     * Each party passes its own outgoing buffer and the buffer for the incoming data, so the
+     * caller does not need a placeholder for the side it does not own. Party 0 sends before it
+     * receives and party 1 receives before it sends. No memory is allocated, so the buffers can
+     * be drawn from the party's workspace.
+     *
+     * @param send The buffer to be sent to the other party.
+     * @param recv The buffer where the received values will be stored (same size as 'send').
+     */
+    void Exchange(utils::Span<const uint32_t> send, utils::Span<uint32_t> recv);
+
+    /**
+     * @brief Sends a buffer of data to the other party without waiting for a reply.
+     *
+     * @param send The buffer to be sent to the other party.
+     */
+    void Send(utils::Span<const uint32_t> send);
+
+    /**
+     * @brief Receives a buffer of data from the other party.
+     *
+     * @param recv The buffer where the received values will be stored.
+     */
+    void Recv(utils::Span<uint32_t> recv);
+
     uint32_t GetTotalBytesSent() const;
 
     uint32_t OutputTotalBytesSent(const std::string &message) const;
@@ -109,10 +198,14 @@ public:
     void ClearTotalBytesSent();
 
 private:
-    const uint32_t id_;         /**< ID of the party. */
-    comm::Server   p0_;         /**< Server communication instance. */
-    comm::Client   p1_;         /**< Client communication instance. */
-    bool           is_started_; /**< Flag indicating whether the communication has started. */
+    const uint32_t                     id_;         /**< ID of the party. */
+    comm::Server                       p0_;         /**< Server communication instance. */
+    comm::Client                       p1_;         /**< Client communication instance. */
+    bool                               is_started_; /**< Flag indicating whether the communication has started. */
+    std::shared_ptr<utils::ThreadPool> pool_;       /**< Thread pool for the local phases of batched operations. */
+    std::shared_ptr<utils::Workspace>  workspace_;  /**< Scratch-buffer arena for the temporaries of batched operations. */
+    std::shared_ptr<rng::Prg>          common_prg_; /**< PRG seeded with the seed shared by both parties. */
+    std::shared_ptr<rng::Prg>          own_prg_;    /**< PRG seeded with a seed known only to this party. */
 };
 
 struct BeaverTriplet {
@@ -155,6 +248,58 @@ struct BeaverTriplet {
 
 using bts_t = std::vector<BeaverTriplet>;
 
+/**
+ * @brief Square pair (a, a^2) used for secure squaring.
+ */
+struct SquarePair {
+    uint32_t a;  /**< Random mask 'a' (or a share of it). */
+    uint32_t aa; /**< Square 'a^2' (or a share of it). */
+};
+
+using sps_t = std::vector<SquarePair>;
+
+/**
+ * @brief Seed-compressed Beaver triple shares held by one party.
+ *
+ * Party 0 holds only a seed that expands to (a_0, b_0, c_0) for every triple.
+ * Party 1 holds a seed that expands to (a_1, b_1) and an explicit correction word
+ * c_1 = a * b - c_0 for every triple.
+ */
+struct CompressedBeaverTriplets {
+    uint32_t              party_id; /**< ID of the party holding the shares. */
+    uint32_t              num;      /**< Number of Beaver triples. */
+    rng::seed_t           seed;     /**< PRG seed of the party. */
+    std::vector<uint32_t> c_vec;    /**< Correction words for 'c' (party 1 only). */
+};
+
+using cbts_t = std::pair<CompressedBeaverTriplets, CompressedBeaverTriplets>;
+
+/**
+ * @brief Correlated Beaver triples (a, b_i, a * b_i) sharing a single 'a'.
+ *
+ * Used to multiply one secret by many secrets, so that x - a is opened only once.
+ */
+struct BroadcastBeaverTriplets {
+    uint32_t              a;     /**< Common mask 'a' (or a share of it). */
+    std::vector<uint32_t> b_vec; /**< Masks 'b_i' (or shares of them). */
+    std::vector<uint32_t> c_vec; /**< Products 'a * b_i' (or shares of them). */
+};
+
+using bbts_t = std::pair<BroadcastBeaverTriplets, BroadcastBeaverTriplets>;
+
+/**
+ * @brief Power tuples (r, r^2, ..., r^k) used for one-round polynomial evaluation.
+ *
+ * The powers of the i-th tuple are stored at powers[i * degree + (j - 1)] for j = 1, ..., degree.
+ */
+struct PowerTuples {
+    uint32_t              num;    /**< Number of tuples. */
+    uint32_t              degree; /**< Highest power 'k' of each tuple. */
+    std::vector<uint32_t> powers; /**< Powers of the masks 'r' (or shares of them). */
+};
+
+using pts_t = std::pair<PowerTuples, PowerTuples>;
+
 class AdditiveSecretSharing {
 
 public:
@@ -208,10 +353,66 @@ public:
      */
     shares_t Share(const std::vector<uint32_t> &x_vec) const;
 
+    /**
+     * @brief Shares a vector of secret values using the threads of a thread pool.
+     *
+     * Each chunk of the vector draws its share of party 0 from its own PRG with a fresh seed,
+     * so the chunks run independently.
+     *
+     * @param x_vec The vector of secret values to be shared.
+     * @param pool The thread pool running the chunks (e.g. Party::GetThreadPool()).
+     * @return A pair of share vectors representing the secret values.
+     */
+    shares_t Share(const std::vector<uint32_t> &x_vec, utils::ThreadPool &pool) const;
+
+    /**
+     * @brief Shares a vector of secret values with a seed-expanded share for party 0.
+     *
+     * The share of party 0 is the PRG expansion of a fresh seed, so only the seed and the
+     * masked vector of party 1 need to be stored or sent.
+     *
+     * @param x_vec The vector of secret values to be shared.
+     * @return A pair of the seed of party 0 and the share vector of party 1.
+     */
+    seeded_shares_t ShareWithSeed(const std::vector<uint32_t> &x_vec) const;
+
+    /**
+     * @brief Expands a seed into the share vector of party 0.
+     *
+     * @param x_seed The seed produced by ShareWithSeed.
+     * @param x_vec_0 The vector to store the expanded share.
+     */
+    void ExpandShare(const ShareSeed &x_seed, std::vector<uint32_t> &x_vec_0) const;
+
+    /**
+     * @brief Generates shares of random values without communication (pseudorandom secret sharing).
+     *
+     * Each party expands its own PRG, so the shared values are uniformly random and unknown to both parties.
+     *
+     * @param party The party generating its shares.
+     * @param num The number of random values.
+     * @param r_vec The vector to store the shares of the random values.
+     */
+    void RandomShares(Party &party, const uint32_t num, std::vector<uint32_t> &r_vec) const;
+
+    /**
+     * @brief Generates shares of zero without communication (pseudorandom secret sharing).
+     *
+     * Both parties expand the common PRG into the same values s and take s and -s respectively.
+     * Each party knows both shares, so adding them only hides values from third parties (e.g. a
+     * dealer or an observer of a stored share); it keeps the PRG streams of the parties in sync.
+     *
+     * @param party The party generating its shares.
+     * @param num The number of zero values.
+     * @param z_vec The vector to store the shares of zero.
+     */
+    void ZeroShares(Party &party, const uint32_t num, std::vector<uint32_t> &z_vec) const;
+
     /**
      * @brief Reconstructs a vector of secret values from their shares.
      *
      * Reconstructs the vector of secret values from their share vectors 'x_vec_0' and 'x_vec_1' using secret sharing techniques.
+     * Only the share vector of the own party is read; the peer shares are received into the party workspace.
      *
      * @param party The Party object representing the party that will perform the reconstruction.
      * @param x_vec_0 The first share vector of the secret values.
@@ -243,6 +444,42 @@ public:
      */
     void Reconst(Party &party, std::array<uint32_t, 4> &x_arr_0, std::array<uint32_t, 4> &x_arr_1, std::array<uint32_t, 4> &output) const;
 
+    /**
+     * @brief Reconstructs secret values in place.
+     *
+     * Each party passes its own shares, which are overwritten with the reconstructed values.
+     * Only the shares of the other party are received into a workspace buffer, so no
+     * placeholder or output vector is needed.
+     *
+     * @param party The Party object representing the party that will perform the reconstruction.
+     * @param x_sh The shares of the party, replaced by the reconstructed secret values.
+     */
+    void Reconst(Party &party, utils::Span<uint32_t> x_sh) const;
+
+    /**
+     * @brief Reveals a secret value to a single party.
+     *
+     * Only the other party sends its share, so the opening costs one message in one direction.
+     *
+     * @param party The Party object representing the party that will perform the reveal.
+     * @param party_id The ID of the party that receives the secret value.
+     * @param x_sh The share of the party.
+     * @return The secret value for party 'party_id', and 0 for the other party.
+     */
+    uint32_t RevealTo(Party &party, const uint32_t party_id, const uint32_t x_sh) const;
+
+    /**
+     * @brief Reveals secret values to a single party in place.
+     *
+     * Only the other party sends its shares. The shares of party 'party_id' are overwritten
+     * with the secret values, and the shares of the other party are left unchanged.
+     *
+     * @param party The Party object representing the party that will perform the reveal.
+     * @param party_id The ID of the party that receives the secret values.
+     * @param x_sh The shares of the party.
+     */
+    void RevealTo(Party &party, const uint32_t party_id, utils::Span<uint32_t> x_sh) const;
+
     /**
      * @brief Generates Beaver triples.
      *
@@ -264,6 +501,85 @@ public:
      */
     std::pair<bts_t, bts_t> ShareBeaverTriples(const bts_t &bt_vec) const;
 
+    /**
+     * @brief Shares Beaver triples using the threads of a thread pool.
+     *
+     * Each chunk of the triples draws the shares of party 0 from its own PRG with a fresh seed.
+     *
+     * @param bt_vec The vector of Beaver triples to be shared.
+     * @param pool The thread pool running the chunks (e.g. Party::GetThreadPool()).
+     * @return A pair of share vectors representing the Beaver triples.
+     */
+    std::pair<bts_t, bts_t> ShareBeaverTriples(const bts_t &bt_vec, utils::ThreadPool &pool) const;
+
+    /**
+     * @brief Generates seed-compressed Beaver triple shares.
+     *
+     * Generates 'bt_num' Beaver triples whose shares are derived from two PRG seeds.
+     * Party 0 receives only its seed, and party 1 receives its seed and one correction word per triple.
+     *
+     * @param bt_num The number of Beaver triples to generate.
+     * @return A pair of compressed Beaver triple shares for party 0 and party 1.
+     */
+    cbts_t GenerateCompressedBeaverTriples(const uint32_t bt_num) const;
+
+    /**
+     * @brief Expands seed-compressed Beaver triple shares.
+     *
+     * @param cbt The compressed Beaver triple shares of the party.
+     * @param bt_vec The vector to store the expanded Beaver triple shares.
+     */
+    void ExpandBeaverTriples(const CompressedBeaverTriplets &cbt, bts_t &bt_vec) const;
+
+    /**
+     * @brief Generates correlated Beaver triples sharing a single 'a'.
+     *
+     * @param bt_num The number of triples (a, b_i, a * b_i) to generate.
+     * @return The correlated Beaver triples.
+     */
+    BroadcastBeaverTriplets GenerateBroadcastBeaverTriples(const uint32_t bt_num) const;
+
+    /**
+     * @brief Shares correlated Beaver triples using secret sharing.
+     *
+     * @param bbt The correlated Beaver triples to be shared.
+     * @return A pair of shares of the correlated Beaver triples.
+     */
+    bbts_t ShareBroadcastBeaverTriples(const BroadcastBeaverTriplets &bbt) const;
+
+    /**
+     * @brief Generates square pairs.
+     *
+     * @param sp_num The number of square pairs (a, a^2) to generate.
+     * @param sp_vec The vector to store the generated square pairs.
+     */
+    void GenerateSquarePairs(const uint32_t sp_num, sps_t &sp_vec) const;
+
+    /**
+     * @brief Shares square pairs using secret sharing.
+     *
+     * @param sp_vec The vector of square pairs to be shared.
+     * @return A pair of share vectors representing the square pairs.
+     */
+    std::pair<sps_t, sps_t> ShareSquarePairs(const sps_t &sp_vec) const;
+
+    /**
+     * @brief Generates power tuples.
+     *
+     * @param num The number of power tuples to generate.
+     * @param degree The highest power 'k' of each tuple (r, r^2, ..., r^k).
+     * @return The generated power tuples.
+     */
+    PowerTuples GeneratePowerTuples(const uint32_t num, const uint32_t degree) const;
+
+    /**
+     * @brief Shares power tuples using secret sharing.
+     *
+     * @param pt The power tuples to be shared.
+     * @return A pair of shares of the power tuples.
+     */
+    pts_t SharePowerTuples(const PowerTuples &pt) const;
+
     /**
      * @brief Performs secure multiplication of two secret-shared values.
      *
@@ -309,6 +625,134 @@ public:
      */
     void Mult(Party &party, const bts_t &bt_vec, const std::vector<uint32_t> &x, const std::vector<uint32_t> &y, std::vector<uint32_t> &z) const;
 
+    /**
+     * @brief Performs secure multiplication of one secret-shared value with a vector of secret-shared values.
+     *
+     * Computes z_i = x * y_i using correlated Beaver triples sharing a single 'a', so x - a is
+     * opened once and only n + 1 words are opened instead of 2n.
+     *
+     * @param party The party object representing the current party.
+     * @param bbt The correlated Beaver triples (at least as many as 'y_vec').
+     * @param x The secret-shared value of the common operand.
+     * @param y_vec The vector of secret-shared values of the other operands.
+     * @param z_vec The vector to store the secret-shared results of the multiplications.
+     */
+    void MultBroadcast(Party &party, const BroadcastBeaverTriplets &bbt, const uint32_t x, const std::vector<uint32_t> &y_vec, std::vector<uint32_t> &z_vec) const;
+
+    /**
+     * @brief Performs secure squaring of a secret-shared value.
+     *
+     * Opens only d = x - a and computes x^2 = d^2 + 2 * d * a + a^2 with a square pair.
+     *
+     * @param party The party object representing the current party.
+     * @param sp The square pair used for secure squaring.
+     * @param x The secret-shared value to be squared.
+     * @return The secret-shared square of 'x'.
+     */
+    uint32_t Square(Party &party, const SquarePair &sp, const uint32_t x) const;
+
+    /**
+     * @brief Performs secure squaring of a vector of secret-shared values.
+     *
+     * Opens one word per element in a single round, half of what Mult(x, x) opens.
+     *
+     * @param party The party object representing the current party.
+     * @param sp_vec The vector of square pairs used for secure squaring.
+     * @param x_vec The vector of secret-shared values to be squared.
+     * @param z_vec The vector to store the secret-shared squares.
+     */
+    void Square(Party &party, const sps_t &sp_vec, const std::vector<uint32_t> &x_vec, std::vector<uint32_t> &z_vec) const;
+
+    /**
+     * @brief Evaluates a public polynomial on a vector of secret-shared values in one round.
+     *
+     * Opens only d = x - r and expands x^j = (d + r)^j binomially with the shared powers of 'r',
+     * so a polynomial of any degree up to the degree of the power tuples costs one opening per element.
+     *
+     * @param party The party object representing the current party.
+     * @param pt The power tuples (at least as many as 'x_vec', of degree at least coeffs.size() - 1).
+     * @param coeffs The coefficients c_0, c_1, ..., c_k of the polynomial c_0 + c_1 * x + ... + c_k * x^k.
+     * @param x_vec The vector of secret-shared values.
+     * @param z_vec The vector to store the secret-shared values of the polynomial.
+     */
+    void EvalPolynomial(Party &party, const PowerTuples &pt, const std::vector<uint32_t> &coeffs, const std::vector<uint32_t> &x_vec, std::vector<uint32_t> &z_vec) const;
+
+    /**
+     * @brief Selects between two secret-shared values with a secret-shared selector.
+     *
+     * Computes b ? x : y as y + b * (x - y) with one multiplication.
+     *
+     * @param party The party object representing the current party.
+     * @param bt The Beaver triplet used for the multiplication.
+     * @param b The secret-shared selector (0 or 1).
+     * @param x The secret-shared value selected when b = 1.
+     * @param y The secret-shared value selected when b = 0.
+     * @return The secret-shared selected value.
+     */
+    uint32_t Select(Party &party, const BeaverTriplet &bt, const uint32_t b, const uint32_t x, const uint32_t y) const;
+
+    /**
+     * @brief Selects between two vectors of secret-shared values element-wise.
+     *
+     * Costs one multiplication per element, all opened in a single round.
+     *
+     * @param party The party object representing the current party.
+     * @param bt_vec The vector of Beaver triplets used for the multiplications.
+     * @param b_vec The vector of secret-shared selectors (0 or 1).
+     * @param x_vec The vector of secret-shared values selected when b = 1.
+     * @param y_vec The vector of secret-shared values selected when b = 0.
+     * @param z_vec The vector to store the secret-shared selected values.
+     */
+    void Select(Party &party, const bts_t &bt_vec, const std::vector<uint32_t> &b_vec, const std::vector<uint32_t> &x_vec, const std::vector<uint32_t> &y_vec, std::vector<uint32_t> &z_vec) const;
+
+    /**
+     * @brief Selects between views of secret-shared values element-wise.
+     *
+     * Same as the vector version, but the operands may be parts of larger buffers (e.g. a slice
+     * of a triple vector), and the number of selections is the size of 'z_vec'.
+     *
+     * @param party The party object representing the current party.
+     * @param bt_vec The Beaver triplets used for the multiplications.
+     * @param b_vec The secret-shared selectors (0 or 1).
+     * @param x_vec The secret-shared values selected when b = 1.
+     * @param y_vec The secret-shared values selected when b = 0.
+     * @param z_vec The view to store the secret-shared selected values.
+     */
+    void Select(Party &party, utils::Span<const BeaverTriplet> bt_vec, utils::Span<const uint32_t> b_vec, utils::Span<const uint32_t> x_vec, utils::Span<const uint32_t> y_vec, utils::Span<uint32_t> z_vec) const;
+
+    /**
+     * @brief Performs 'N' secure multiplications in one round with fixed-size buffers.
+     *
+     * All 2N masked differences live in stack arrays and are opened in a single exchange,
+     * so small gadgets (e.g. comparators and adders) run without heap allocation.
+     *
+     * @tparam N The number of multiplications.
+     * @param party The party object representing the current party.
+     * @param bt_arr The Beaver triplets used for the multiplications.
+     * @param x_arr The secret-shared values of the first operands.
+     * @param y_arr The secret-shared values of the second operands.
+     * @return The secret-shared results of the multiplications.
+     */
+    template <size_t N>
+    std::array<uint32_t, N> MultN(Party &party, const std::array<BeaverTriplet, N> &bt_arr, const std::array<uint32_t, N> &x_arr, const std::array<uint32_t, N> &y_arr) const {
+        std::array<uint32_t, 2 * N> de_own, de_peer;
+        std::array<uint32_t, N>     z_arr;
+        const uint32_t              de_mask = (party.GetId() == 0) ? ~0U : 0U;    // Only party 0 adds the public term
+        // Calculate the own shares of the differences de.
+        for (size_t i = 0; i < N; i++) {
+            de_own[2 * i]     = utils::Mod(x_arr[i] - bt_arr[i].a, this->bitsize_);
+            de_own[2 * i + 1] = utils::Mod(y_arr[i] - bt_arr[i].b, this->bitsize_);
+        }
+        party.Exchange(de_own, de_peer);
+        for (size_t i = 0; i < N; i++) {
+            // Calculate the final differences de from the own and received shares.
+            uint32_t d = utils::Mod(de_own[2 * i] + de_peer[2 * i], this->bitsize_);
+            uint32_t e = utils::Mod(de_own[2 * i + 1] + de_peer[2 * i + 1], this->bitsize_);
+            z_arr[i]   = utils::Mod((e * bt_arr[i].a) + (d * bt_arr[i].b) + bt_arr[i].c + ((d * e) & de_mask), this->bitsize_);
+        }
+        return z_arr;
+    }
+
 private:
     uint32_t bitsize_;
 };
@@ -356,10 +800,67 @@ public:
      */
     shares_t Share(const std::vector<uint32_t> &x_vec) const;
 
+    /**
+     * @brief Shares a vector of secret values using the threads of a thread pool.
+     *
+     * Each chunk of the vector draws its share of party 0 from its own PRG with a fresh seed,
+     * so the chunks run independently.
+     *
+     * @param x_vec The vector of secret values to be shared.
+     * @param pool The thread pool running the chunks (e.g. Party::GetThreadPool()).
+     * @return A pair of share vectors representing the secret values.
+     */
+    shares_t Share(const std::vector<uint32_t> &x_vec, utils::ThreadPool &pool) const;
+
+    /**
+     * @brief Shares a vector of secret values with a seed-expanded share for party 0.
+     *
+     * The share of party 0 is the PRG expansion of a fresh seed, so only the seed and the
+     * masked vector of party 1 need to be stored or sent.
+     *
+     * @param x_vec The vector of secret values to be shared.
+     * @return A pair of the seed of party 0 and the share vector of party 1.
+     */
+    seeded_shares_t ShareWithSeed(const std::vector<uint32_t> &x_vec) const;
+
+    /**
+     * @brief Expands a seed into the share vector of party 0.
+     *
+     * @param x_seed The seed produced by ShareWithSeed.
+     * @param x_vec_0 The vector to store the expanded share.
+     */
+    void ExpandShare(const ShareSeed &x_seed, std::vector<uint32_t> &x_vec_0) const;
+
+    /**
+     * @brief Generates shares of random bits without communication (pseudorandom secret sharing).
+     *
+     * Each party expands its own PRG, so the shared bits are uniformly random and unknown to both parties.
+     * Random bits shared over Z_{2^bitsize} are not free for two parties; use daBits (ShareConversion) for them.
+     *
+     * @param party The party generating its shares.
+     * @param num The number of random bits.
+     * @param r_vec The vector to store the shares of the random bits.
+     */
+    void RandomShares(Party &party, const uint32_t num, std::vector<uint32_t> &r_vec) const;
+
+    /**
+     * @brief Generates shares of zero without communication (pseudorandom secret sharing).
+     *
+     * Both parties expand the common PRG into the same bits s and take s as their share.
+     * Each party knows both shares, so adding them only hides values from third parties (e.g. a
+     * dealer or an observer of a stored share); it keeps the PRG streams of the parties in sync.
+     *
+     * @param party The party generating its shares.
+     * @param num The number of zero values.
+     * @param z_vec The vector to store the shares of zero.
+     */
+    void ZeroShares(Party &party, const uint32_t num, std::vector<uint32_t> &z_vec) const;
+
     /**
      * @brief Reconstructs a vector of secret values from their shares.
      *
      * Reconstructs the vector of secret values from their share vectors 'x_vec_0' and 'x_vec_1' using secret sharing techniques.
+     * Only the share vector of the own party is read; the peer shares are received into the party workspace.
      *
      * @param party The Party object representing the party that will perform the reconstruction.
      * @param x_vec_0 The first share vector of the secret values.
@@ -391,6 +892,42 @@ public:
      */
     void Reconst(Party &party, std::array<uint32_t, 4> &x_arr_0, std::array<uint32_t, 4> &x_arr_1, std::array<uint32_t, 4> &output) const;
 
+    /**
+     * @brief Reconstructs secret values in place.
+     *
+     * Each party passes its own shares, which are overwritten with the reconstructed values.
+     * Only the shares of the other party are received into a workspace buffer, so no
+     * placeholder or output vector is needed.
+     *
+     * @param party The Party object representing the party that will perform the reconstruction.
+     * @param x_sh The shares of the party, replaced by the reconstructed secret values.
+     */
+    void Reconst(Party &party, utils::Span<uint32_t> x_sh) const;
+
+    /**
+     * @brief Reveals a secret value to a single party.
+     *
+     * Only the other party sends its share, so the opening costs one message in one direction.
+     *
+     * @param party The Party object representing the party that will perform the reveal.
+     * @param party_id The ID of the party that receives the secret value.
+     * @param x_sh The share of the party.
+     * @return The secret value for party 'party_id', and 0 for the other party.
+     */
+    uint32_t RevealTo(Party &party, const uint32_t party_id, const uint32_t x_sh) const;
+
+    /**
+     * @brief Reveals secret values to a single party in place.
+     *
+     * Only the other party sends its shares. The shares of party 'party_id' are overwritten
+     * with the secret values, and the shares of the other party are left unchanged.
+     *
+     * @param party The Party object representing the party that will perform the reveal.
+     * @param party_id The ID of the party that receives the secret values.
+     * @param x_sh The shares of the party.
+     */
+    void RevealTo(Party &party, const uint32_t party_id, utils::Span<uint32_t> x_sh) const;
+
     /**
      * @brief Generates Beaver triples.
      *
@@ -412,6 +949,74 @@ public:
      */
     std::pair<bts_t, bts_t> ShareBeaverTriples(const bts_t &bt_vec) const;
 
+    /**
+     * @brief Shares Beaver triples using the threads of a thread pool.
+     *
+     * Each chunk of the triples draws the shares of party 0 from its own PRG with a fresh seed.
+     *
+     * @param bt_vec The vector of Beaver triples to be shared.
+     * @param pool The thread pool running the chunks (e.g. Party::GetThreadPool()).
+     * @return A pair of share vectors representing the Beaver triples.
+     */
+    std::pair<bts_t, bts_t> ShareBeaverTriples(const bts_t &bt_vec, utils::ThreadPool &pool) const;
+
+    /**
+     * @brief Generates seed-compressed Beaver triple shares.
+     *
+     * Generates 'bt_num' Beaver triples whose shares are derived from two PRG seeds.
+     * Party 0 receives only its seed, and party 1 receives its seed and one correction word per triple.
+     *
+     * @param bt_num The number of Beaver triples to generate.
+     * @return A pair of compressed Beaver triple shares for party 0 and party 1.
+     */
+    cbts_t GenerateCompressedBeaverTriples(const uint32_t bt_num) const;
+
+    /**
+     * @brief Expands seed-compressed Beaver triple shares.
+     *
+     * @param cbt The compressed Beaver triple shares of the party.
+     * @param bt_vec The vector to store the expanded Beaver triple shares.
+     */
+    void ExpandBeaverTriples(const CompressedBeaverTriplets &cbt, bts_t &bt_vec) const;
+
+    /**
+     * @brief Generates packed Beaver triples for bitwise AND operations on whole words.
+     *
+     * Each triple holds random words 'a' and 'b' and c = a & b, so one triple serves 32 bit-wise ANDs.
+     *
+     * @param bt_num The number of triples to generate.
+     * @param bt_vec The vector to store the generated triples.
+     */
+    void GeneratePackedBeaverTriples(const uint32_t bt_num, bts_t &bt_vec) const;
+
+    /**
+     * @brief Shares packed Beaver triples using secret sharing with word-wide shares.
+     *
+     * @param bt_vec The vector of packed Beaver triples to be shared.
+     * @return A pair of share vectors representing the packed Beaver triples.
+     */
+    std::pair<bts_t, bts_t> SharePackedBeaverTriples(const bts_t &bt_vec) const;
+
+    /**
+     * @brief Generates bit-word Beaver triples for selecting packed boolean values.
+     *
+     * Each triple holds a random bit 'a', a random word 'b' and c = a ? b : 0.
+     *
+     * @param bt_num The number of triples to generate.
+     * @param bt_vec The vector to store the generated triples.
+     */
+    void GenerateSelectTriples(const uint32_t bt_num, bts_t &bt_vec) const;
+
+    /**
+     * @brief Shares bit-word Beaver triples using secret sharing.
+     *
+     * 'a' is shared as a bit, and 'b' and 'c' are shared as full words.
+     *
+     * @param bt_vec The vector of bit-word Beaver triples to be shared.
+     * @return A pair of share vectors representing the triples.
+     */
+    std::pair<bts_t, bts_t> ShareSelectTriples(const bts_t &bt_vec) const;
+
     /**
      * @brief Performs secure bitwise AND operation on two secret-shared boolean values.
      *
@@ -441,6 +1046,53 @@ public:
      */
     void And(Party &party, const bts_t &btb_vec, const std::vector<uint32_t> &xb_vec, const std::vector<uint32_t> &yb_vec, std::vector<uint32_t> &zb_vec) const;
 
+    /**
+     * @brief Performs secure bitwise AND operations on views of secret-shared boolean values.
+     *
+     * Same as the vector version, but the operands may be parts of larger buffers (e.g. workspace
+     * buffers or a slice of a triple vector), so several gadgets can share one opening.
+     *
+     * @param party The party object representing the current party.
+     * @param btb_vec The Beaver triplets used for the AND operations.
+     * @param xb_vec The secret-shared boolean values of the first operands.
+     * @param yb_vec The secret-shared boolean values of the second operands.
+     * @param zb_vec The view to store the secret-shared results of the AND operations.
+     */
+    void And(Party &party, utils::Span<const BeaverTriplet> btb_vec, utils::Span<const uint32_t> xb_vec, utils::Span<const uint32_t> yb_vec, utils::Span<uint32_t> zb_vec) const;
+
+    /**
+     * @brief Performs 'N' secure bitwise AND operations in one round with fixed-size buffers.
+     *
+     * All 2N masked differences live in stack arrays and are opened in a single exchange,
+     * so small gadgets (e.g. comparators and adders) run without heap allocation.
+     *
+     * @tparam N The number of AND operations.
+     * @param party The party object representing the current party.
+     * @param btb_arr The Beaver triplets used for the AND operations.
+     * @param xb_arr The secret-shared boolean values of the first operands.
+     * @param yb_arr The secret-shared boolean values of the second operands.
+     * @return The secret-shared results of the AND operations.
+     */
+    template <size_t N>
+    std::array<uint32_t, N> AndN(Party &party, const std::array<BeaverTriplet, N> &btb_arr, const std::array<uint32_t, N> &xb_arr, const std::array<uint32_t, N> &yb_arr) const {
+        std::array<uint32_t, 2 * N> de_own, de_peer;
+        std::array<uint32_t, N>     zb_arr;
+        const uint32_t              de_mask = (party.GetId() == 0) ? ~0U : 0U;    // Only party 0 adds the public term
+        // Calculate the own shares of the differences de.
+        for (size_t i = 0; i < N; i++) {
+            de_own[2 * i]     = xb_arr[i] ^ btb_arr[i].a;
+            de_own[2 * i + 1] = yb_arr[i] ^ btb_arr[i].b;
+        }
+        party.Exchange(de_own, de_peer);
+        for (size_t i = 0; i < N; i++) {
+            // Calculate the final differences de from the own and received shares.
+            uint32_t d = de_own[2 * i] ^ de_peer[2 * i];
+            uint32_t e = de_own[2 * i + 1] ^ de_peer[2 * i + 1];
+            zb_arr[i]  = (e & btb_arr[i].a) ^ (d & btb_arr[i].b) ^ btb_arr[i].c ^ (d & e & de_mask);
+        }
+        return zb_arr;
+    }
+
     /**
      * @brief Performs secure bitwise OR operation on two secret-shared boolean values.
      *
@@ -466,9 +1118,115 @@ public:
      * @param btb_vec The vector of Beaver triplets used for secure bitwise OR operations.
      * @param xb_vec The vector of secret-shared boolean values of the first operands.
      * @param yb_vec The vector of secret-shared boolean values of the second operands.
-     * @param zb_vec The vector to store the secret-shared results of the bitwise OR operations.
+     * @param zb_vec The vector to store the secret-shared results of the bitwise OR operations (must not alias 'xb_vec' or 'yb_vec').
      */
     void Or(Party &party, const bts_t &btb_vec, const std::vector<uint32_t> &xb_vec, const std::vector<uint32_t> &yb_vec, std::vector<uint32_t> &zb_vec) const;
+
+    /**
+     * @brief Selects between two secret-shared packed boolean values with a secret-shared selector bit.
+     *
+     * Computes b ? x : y as y ^ (b & (x ^ y)), where the selector bit is applied to every bit
+     * of the word, with one bit-word AND.
+     *
+     * @param party The party object representing the current party.
+     * @param bt_s The bit-word Beaver triplet (see GenerateSelectTriples).
+     * @param b_b The secret-shared selector bit.
+     * @param x_b The secret-shared packed value selected when b = 1.
+     * @param y_b The secret-shared packed value selected when b = 0.
+     * @return The secret-shared selected value.
+     */
+    uint32_t Select(Party &party, const BeaverTriplet &bt_s, const uint32_t b_b, const uint32_t x_b, const uint32_t y_b) const;
+
+    /**
+     * @brief Selects between two vectors of secret-shared packed boolean values element-wise.
+     *
+     * Costs one bit-word AND per element, all opened in a single round.
+     *
+     * @param party The party object representing the current party.
+     * @param bts_vec The vector of bit-word Beaver triplets (see GenerateSelectTriples).
+     * @param bb_vec The vector of secret-shared selector bits.
+     * @param xb_vec The vector of secret-shared packed values selected when b = 1.
+     * @param yb_vec The vector of secret-shared packed values selected when b = 0.
+     * @param zb_vec The vector to store the secret-shared selected values.
+     */
+    void Select(Party &party, const bts_t &bts_vec, const std::vector<uint32_t> &bb_vec, const std::vector<uint32_t> &xb_vec, const std::vector<uint32_t> &yb_vec, std::vector<uint32_t> &zb_vec) const;
+};
+
+/**
+ * @class MultBatch
+ * @brief Builder that evaluates independent Mult and And groups in a single round.
+ *
+ * Each group is a set of element-wise multiplications (arithmetic, over Z_{2^bitsize}) or
+ * ANDs (Boolean) of its own length with its own Beaver triples. Run() packs the masked
+ * differences of all groups into one Exchange and scatters the products back into the
+ * output buffers of the groups, so independent batches cost one round instead of one each.
+ * The buffers passed to AddMult and AddAnd must stay valid until Run() returns.
+ */
+class MultBatch {
+public:
+    /**
+     * @brief Constructs an empty MultBatch.
+     *
+     * @param bitsize The bit size of the arithmetic groups.
+     */
+    explicit MultBatch(const uint32_t bitsize = 32);
+
+    /**
+     * @brief Adds a group of arithmetic multiplications z = x * y.
+     *
+     * @param bt_vec The Beaver triple shares (at least as many as the outputs).
+     * @param x_vec The shares of the first operands.
+     * @param y_vec The shares of the second operands.
+     * @param z_vec The buffer to store the shares of the products.
+     */
+    void AddMult(utils::Span<const BeaverTriplet> bt_vec, utils::Span<const uint32_t> x_vec, utils::Span<const uint32_t> y_vec, utils::Span<uint32_t> z_vec);
+
+    /**
+     * @brief Adds a group of Boolean ANDs z = x & y (bits or packed words, depending on the triples).
+     *
+     * @param btb_vec The Boolean Beaver triple shares (at least as many as the outputs).
+     * @param xb_vec The shares of the first operands.
+     * @param yb_vec The shares of the second operands.
+     * @param zb_vec The buffer to store the shares of the products.
+     */
+    void AddAnd(utils::Span<const BeaverTriplet> btb_vec, utils::Span<const uint32_t> xb_vec, utils::Span<const uint32_t> yb_vec, utils::Span<uint32_t> zb_vec);
+
+    /**
+     * @brief Evaluates all groups with a single exchange of masked differences.
+     *
+     * @param party The party that evaluates the batch.
+     */
+    void Run(Party &party) const;
+
+    /**
+     * @brief Removes all groups, so the builder can be reused.
+     */
+    void Clear();
+
+    size_t GetNumGroups() const;
+    size_t GetNumElements() const;
+
+private:
+    /**
+     * @brief A group of multiplications and its offset in the packed differences.
+     */
+    struct Group {
+        bool                             is_boolean; /**< True for an And group. */
+        utils::Span<const BeaverTriplet> bt_vec;     /**< Beaver triple shares. */
+        utils::Span<const uint32_t>      x_vec;      /**< Shares of the first operands. */
+        utils::Span<const uint32_t>      y_vec;      /**< Shares of the second operands. */
+        utils::Span<uint32_t>            z_vec;      /**< Output buffer. */
+        size_t                           offset;     /**< Offset of the group in the packed elements. */
+    };
+
+    const uint32_t     bitsize_;      /**< Bit size of the arithmetic groups. */
+    std::vector<Group> groups_;       /**< Groups in insertion order. */
+    size_t             num_elements_; /**< Total number of multiplications. */
+
+    /**
+     * @brief Checks the buffer sizes of a group and appends it.
+     */
+    void AddGroup(const bool is_boolean, utils::Span<const BeaverTriplet> bt_vec, utils::Span<const uint32_t> x_vec, utils::Span<const uint32_t> y_vec, utils::Span<uint32_t> z_vec);
 };
 
 class ShareHandler {
@@ -504,6 +1262,17 @@ public:
      */
     void ExportShare(const std::string &file_path_p0, const std::string &file_path_p1, shares_t &x_vec_sh);
 
+    /**
+     * @brief Exports seed-expanded shares to files.
+     *
+     * Writes only the seed to 'file_path_p0' and the masked share vector to 'file_path_p1'.
+     *
+     * @param file_path_p0 The file path for the seed of party 0.
+     * @param file_path_p1 The file path for the share vector of party 1.
+     * @param x_seed_sh The pair containing the seed and the share vector to be exported.
+     */
+    void ExportShare(const std::string &file_path_p0, const std::string &file_path_p1, seeded_shares_t &x_seed_sh);
+
     /**
      * @brief Loads a share value from a file.
      *
@@ -524,6 +1293,16 @@ public:
      */
     void LoadShare(const std::string &file_path, std::vector<uint32_t> &x_vec_sh);
 
+    /**
+     * @brief Loads a share seed from a file.
+     *
+     * The loaded seed is expanded with AdditiveSecretSharing::ExpandShare or BooleanSecretSharing::ExpandShare.
+     *
+     * @param file_path The file path from which to load the share seed.
+     * @param x_seed Reference to the variable to store the loaded share seed.
+     */
+    void LoadShare(const std::string &file_path, ShareSeed &x_seed);
+
     /**
      * @brief Exports Beaver triples to a file.
      *
@@ -555,6 +1334,45 @@ public:
      */
     void LoadBTShare(const std::string &file_path, bts_t &bt_vec_sh);
 
+    /**
+     * @brief Exports seed-compressed Beaver triple shares to files.
+     *
+     * Party 0's file holds only its seed, and party 1's file holds its seed and the correction words.
+     *
+     * @param file_path_p0 The file path for the compressed shares of party 0.
+     * @param file_path_p1 The file path for the compressed shares of party 1.
+     * @param cbt_sh The pair containing the compressed Beaver triple shares to be exported.
+     */
+    void ExportBTShare(const std::string &file_path_p0, const std::string &file_path_p1, cbts_t &cbt_sh);
+
+    /**
+     * @brief Loads seed-compressed Beaver triple shares from a file.
+     *
+     * The loaded shares are expanded with AdditiveSecretSharing::ExpandBeaverTriples or
+     * BooleanSecretSharing::ExpandBeaverTriples.
+     *
+     * @param file_path The file path from which to load the compressed shares.
+     * @param cbt_sh Reference to the object to store the loaded compressed shares.
+     */
+    void LoadBTShare(const std::string &file_path, CompressedBeaverTriplets &cbt_sh);
+
+    /**
+     * @brief Exports square pair shares to files.
+     *
+     * @param file_path_p0 The file path for the first square pair share vector.
+     * @param file_path_p1 The file path for the second square pair share vector.
+     * @param sp_vec_sh The pair containing the square pair share vectors to be exported.
+     */
+    void ExportSPShare(const std::string &file_path_p0, const std::string &file_path_p1, std::pair<sps_t, sps_t> &sp_vec_sh);
+
+    /**
+     * @brief Loads square pair shares from a file.
+     *
+     * @param file_path The file path from which to load the square pair shares.
+     * @param sp_vec_sh Reference to the vector to store the loaded square pair shares.
+     */
+    void LoadSPShare(const std::string &file_path, sps_t &sp_vec_sh);
+
 private:
     const bool    debug_; /**< Flag indicating whether to print debug messages. */
     utils::FileIo io_;    /**< File I/O utility object. */
@@ -577,6 +1395,38 @@ private:
      * @param bt_vec Reference to the vector to store the read Beaver triples.
      */
     void ReadBeaverTriplesFromFile(const std::string &file_path, bts_t &bt_vec);
+
+    /**
+     * @brief Writes seed-compressed Beaver triple shares to a file.
+     *
+     * @param file_path The file path to write the compressed shares.
+     * @param cbt Reference to the compressed shares.
+     */
+    void WriteCompressedBeaverTriplesToFile(const std::string &file_path, CompressedBeaverTriplets &cbt);
+
+    /**
+     * @brief Reads seed-compressed Beaver triple shares from a file.
+     *
+     * @param file_path The file path from which to read the compressed shares.
+     * @param cbt Reference to the object to store the read compressed shares.
+     */
+    void ReadCompressedBeaverTriplesFromFile(const std::string &file_path, CompressedBeaverTriplets &cbt);
+
+    /**
+     * @brief Writes square pairs to a file.
+     *
+     * @param file_path The file path to write the square pairs.
+     * @param sp_vec Reference to the vector containing the square pairs.
+     */
+    void WriteSquarePairsToFile(const std::string &file_path, sps_t &sp_vec);
+
+    /**
+     * @brief Reads square pairs from a file.
+     *
+     * @param file_path The file path from which to read the square pairs.
+     * @param sp_vec Reference to the vector to store the read square pairs.
+     */
+    void ReadSquarePairsFromFile(const std::string &file_path, sps_t &sp_vec);
 };
 
 }    // namespace secret_sharing
@@ -0,0 +1,175 @@
+#include "share_conversion.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "../utils/utils.hpp"
+
+namespace tools {
+namespace secret_sharing {
+
+namespace {
+
+/**
+ * @brief Gets the number of layers of a Kogge-Stone adder, i.e., ceil(log2(bitsize)).
+ */
+uint32_t GetNumLayers(const uint32_t bitsize) {
+    uint32_t num_layers = 0;
+    while ((1U << num_layers) < bitsize) {
+        num_layers++;
+    }
+    return num_layers;
+}
+
+}    // namespace
+
+ShareConversion::ShareConversion(const uint32_t bitsize)
+    : bitsize_(bitsize), num_layers_(GetNumLayers(bitsize)), bss_() {
+    if (bitsize <= 1 || bitsize > 32) {
+        throw std::invalid_argument("The bit size must be between 2 and 32.");
+    }
+}
+
+void ShareConversion::GenerateDaBits(const uint32_t num, dabits_t &dabit_vec) const {
+    dabit_vec.resize(num);
+    for (uint32_t i = 0; i < num; i++) {
+        uint32_t val_r = rng::SecureRng::RandBool();
+        dabit_vec[i]   = DaBit{val_r, val_r};
+    }
+}
+
+std::pair<dabits_t, dabits_t> ShareConversion::ShareDaBits(const dabits_t &dabit_vec) const {
+    dabits_t dabit_vec_0(dabit_vec.size());
+    dabits_t dabit_vec_1(dabit_vec.size());
+    for (size_t i = 0; i < dabit_vec.size(); i++) {
+        dabit_vec_0[i].r_a = utils::Mod(rng::SecureRng::Rand64(), this->bitsize_);
+        dabit_vec_1[i].r_a = utils::Mod(dabit_vec[i].r_a - dabit_vec_0[i].r_a, this->bitsize_);
+        dabit_vec_0[i].r_b = rng::SecureRng::RandBool();
+        dabit_vec_1[i].r_b = dabit_vec[i].r_b ^ dabit_vec_0[i].r_b;
+    }
+    return std::make_pair(dabit_vec_0, dabit_vec_1);
+}
+
+uint32_t ShareConversion::B2A(Party &party, const DaBit &dabit, const uint32_t x_b) const {
+    // Open c = x ^ r.
+    uint32_t c_own = (x_b ^ dabit.r_b) & 1U, c_other = 0;
+    party.Exchange(utils::Span<const uint32_t>(&c_own, 1), utils::Span<uint32_t>(&c_other, 1));
+    uint32_t c = c_own ^ c_other;
+    // x = c + r - 2 * c * r, where only party 0 adds the public term c.
+    return utils::Mod(((party.GetId() == 0) ? c : 0U) + dabit.r_a - 2 * c * dabit.r_a, this->bitsize_);
+}
+
+void ShareConversion::B2A(Party &party, const dabits_t &dabit_vec, const std::vector<uint32_t> &xb_vec, std::vector<uint32_t> &x_vec) const {
+    x_vec.resize(xb_vec.size());
+    this->B2A(party, utils::Span<const DaBit>(dabit_vec), utils::Span<const uint32_t>(xb_vec), utils::Span<uint32_t>(x_vec));
+}
+
+void ShareConversion::B2A(Party &party, utils::Span<const DaBit> dabit_vec, utils::Span<const uint32_t> xb_vec, utils::Span<uint32_t> x_vec) const {
+    size_t num = x_vec.size();
+    if (dabit_vec.size() < num) {
+        throw std::invalid_argument("Not enough daBits for B2A.");
+    }
+    size_t                  num_words = (num + 31) / 32;
+    utils::ThreadPool      &pool      = party.GetThreadPool();
+    utils::Workspace::Frame frame(party.GetWorkspace());
+    // Own masked bits c = x ^ r packed 32 per word, and those received from the other party
+    uint32_t *c_own   = party.GetWorkspace().Allocate(num_words);
+    uint32_t *c_other = party.GetWorkspace().Allocate(num_words);
+    pool.ParallelFor(num_words, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t w = begin; w < end; w++) {
+            uint32_t word = 0;
+            for (size_t i = 32 * w; i < std::min(num, 32 * w + 32); i++) {
+                word |= ((xb_vec[i] ^ dabit_vec[i].r_b) & 1U) << (i % 32);
+            }
+            c_own[w] = word;
+        }
+    });
+    // Exchange the masked bits with the other party.
+    party.Exchange(utils::Span<const uint32_t>(c_own, num_words), utils::Span<uint32_t>(c_other, num_words));
+    const uint32_t c_mask = (party.GetId() == 0) ? 1U : 0U;    // Only party 0 adds the public term c
+    pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            uint32_t c = ((c_own[i / 32] ^ c_other[i / 32]) >> (i % 32)) & 1U;
+            // x = c + r - 2 * c * r
+            x_vec[i] = utils::Mod((c & c_mask) + dabit_vec[i].r_a - 2 * c * dabit_vec[i].r_a, this->bitsize_);
+        }
+    });
+}
+
+uint32_t ShareConversion::GetA2BTripleCount() const {
+    // One AND for the generate bits, two per layer (generate and propagate), and one for the last layer
+    return 2 * this->num_layers_;
+}
+
+void ShareConversion::A2B(Party &party, const bts_t &btp_vec, const std::vector<uint32_t> &x_vec, std::vector<uint32_t> &xb_vec) const {
+    xb_vec.resize(x_vec.size());
+    this->A2B(party, utils::Span<const BeaverTriplet>(btp_vec), utils::Span<const uint32_t>(x_vec), utils::Span<uint32_t>(xb_vec));
+}
+
+void ShareConversion::A2B(Party &party, utils::Span<const BeaverTriplet> btp_vec, utils::Span<const uint32_t> x_vec, utils::Span<uint32_t> xb_vec) const {
+    size_t num = xb_vec.size();
+    if (btp_vec.size() < num * this->GetA2BTripleCount()) {
+        throw std::invalid_argument("Not enough packed Beaver triples for A2B.");
+    }
+    utils::ThreadPool                &pool = party.GetThreadPool();
+    utils::Workspace                 &ws   = party.GetWorkspace();
+    utils::Workspace::Frame           frame(ws);
+    utils::Span<const BeaverTriplet>  bt_rest(btp_vec);
+    // Packed Boolean shares of the summands: party 0 holds (x_0, 0) and party 1 holds (0, x_1)
+    uint32_t *p_init = ws.Allocate(num);        // Propagate bits x_0 ^ x_1 (shared as x_i)
+    uint32_t *lhs    = ws.Allocate(2 * num);    // First operands of the ANDs of one layer
+    uint32_t *rhs    = ws.Allocate(2 * num);    // Second operands of the ANDs of one layer
+    uint32_t *out    = ws.Allocate(2 * num);    // Results [g', p'] of the ANDs of one layer
+    uint32_t *g      = ws.Allocate(num);        // Group generate bits
+    uint32_t *p      = ws.Allocate(num);        // Group propagate bits
+    const uint32_t own_mask = (party.GetId() == 0) ? ~0U : 0U;    // Party 0 holds the left summand
+    pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            uint32_t x = utils::Mod(x_vec[i], this->bitsize_);
+            p_init[i]  = x;
+            lhs[i]     = x & own_mask;
+            rhs[i]     = x & ~own_mask;
+        }
+    });
+    // g = x_0 & x_1
+    this->bss_.And(party, bt_rest.subspan(0, num), utils::Span<const uint32_t>(lhs, num), utils::Span<const uint32_t>(rhs, num), utils::Span<uint32_t>(g, num));
+    bt_rest = bt_rest.subspan(num, bt_rest.size() - num);
+    std::copy(p_init, p_init + num, p);
+    // Kogge-Stone prefix: (g, p) <- (g ^ (p & (g << k)), p & (p << k)) for k = 1, 2, 4, ...
+    for (uint32_t layer = 0; layer < this->num_layers_; layer++) {
+        const uint32_t shift    = 1U << layer;
+        const bool     is_last  = layer + 1 == this->num_layers_;
+        const size_t   num_ands = is_last ? num : 2 * num;    // The propagate bits are not needed after the last layer
+        pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                lhs[i] = p[i];
+                rhs[i] = g[i] << shift;
+                if (!is_last) {
+                    lhs[num + i] = p[i];
+                    rhs[num + i] = p[i] << shift;
+                }
+            }
+        });
+        this->bss_.And(party, bt_rest.subspan(0, num_ands), utils::Span<const uint32_t>(lhs, num_ands), utils::Span<const uint32_t>(rhs, num_ands), utils::Span<uint32_t>(out, num_ands));
+        bt_rest = bt_rest.subspan(num_ands, bt_rest.size() - num_ands);
+        pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                // Group generate and propagate are mutually exclusive, so XOR acts as OR.
+                g[i] ^= out[i];
+                if (!is_last) {
+                    p[i] = out[num + i];
+                }
+            }
+        });
+    }
+    // Sum bits: s = (x_0 ^ x_1) ^ (carry << 1)
+    const uint32_t mask = (this->bitsize_ == 32) ? ~0U : ((1U << this->bitsize_) - 1);
+    pool.ParallelFor(num, [&](const uint32_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            xb_vec[i] = (p_init[i] ^ (g[i] << 1)) & mask;
+        }
+    });
+}
+
+}    // namespace secret_sharing
+}    // namespace tools
@@ -0,0 +1,136 @@
+#ifndef SHARE_CONVERSION_H_
+#define SHARE_CONVERSION_H_
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "secret_sharing.hpp"
+
+namespace tools {
+namespace secret_sharing {
+
+/**
+ * @brief Doubly-authenticated bit: the same random bit 'r' shared both additively and by XOR.
+ */
+struct DaBit {
+    uint32_t r_a; /**< Additive share of 'r' over Z_{2^bitsize} (or 'r' itself). */
+    uint32_t r_b; /**< Boolean share of 'r' (or 'r' itself). */
+};
+
+using dabits_t = std::vector<DaBit>;
+
+/**
+ * @class ShareConversion
+ * @brief Conversions between Boolean shares and additive shares over Z_{2^bitsize}.
+ *
+ * B2A converts Boolean-shared bits to additive shares in one round with dealer-generated
+ * daBits: the parties open c = x ^ r and compute x = c + r - 2 * c * r locally.
+ *
+ * A2B decomposes additive shares into packed Boolean shares (bit j of the word is bit j of
+ * the value) by adding the two shares x_0 + x_1 with a Kogge-Stone parallel-prefix adder on
+ * packed words. The adder needs 1 + ceil(log2(bitsize)) rounds instead of the bitsize rounds
+ * of a ripple-carry adder, and each round is one batched opening for all values.
+ */
+class ShareConversion {
+public:
+    /**
+     * @brief Constructs a ShareConversion object.
+     *
+     * @param bitsize The bit size of the arithmetic ring.
+     */
+    ShareConversion(const uint32_t bitsize = 32);
+
+    /**
+     * @brief Generates daBits.
+     *
+     * @param num The number of daBits to generate.
+     * @param dabit_vec The vector to store the generated daBits.
+     */
+    void GenerateDaBits(const uint32_t num, dabits_t &dabit_vec) const;
+
+    /**
+     * @brief Shares daBits additively and by XOR.
+     *
+     * @param dabit_vec The vector of daBits to be shared.
+     * @return A pair of share vectors representing the daBits.
+     */
+    std::pair<dabits_t, dabits_t> ShareDaBits(const dabits_t &dabit_vec) const;
+
+    /**
+     * @brief Converts a Boolean-shared bit to an additive share.
+     *
+     * @param party The party object representing the current party.
+     * @param dabit The daBit used for the conversion.
+     * @param x_b The Boolean share of the bit.
+     * @return The additive share of the bit.
+     */
+    uint32_t B2A(Party &party, const DaBit &dabit, const uint32_t x_b) const;
+
+    /**
+     * @brief Converts a vector of Boolean-shared bits to additive shares in one round.
+     *
+     * The masked bits are packed 32 per word before they are opened.
+     *
+     * @param party The party object representing the current party.
+     * @param dabit_vec The vector of daBits used for the conversion.
+     * @param xb_vec The vector of Boolean shares of the bits.
+     * @param x_vec The vector to store the additive shares of the bits.
+     */
+    void B2A(Party &party, const dabits_t &dabit_vec, const std::vector<uint32_t> &xb_vec, std::vector<uint32_t> &x_vec) const;
+
+    /**
+     * @brief Converts views of Boolean-shared bits to additive shares in one round.
+     *
+     * Same as the vector version, but the operands may be parts of larger buffers, and the
+     * number of bits is the size of 'x_vec'.
+     *
+     * @param party The party object representing the current party.
+     * @param dabit_vec The daBit shares (at least as many as the bits).
+     * @param xb_vec The Boolean shares of the bits.
+     * @param x_vec The view to store the additive shares of the bits.
+     */
+    void B2A(Party &party, utils::Span<const DaBit> dabit_vec, utils::Span<const uint32_t> xb_vec, utils::Span<uint32_t> x_vec) const;
+
+    /**
+     * @brief Gets the number of packed Beaver triples that A2B consumes per value.
+     */
+    uint32_t GetA2BTripleCount() const;
+
+    /**
+     * @brief Converts a vector of additive shares to packed Boolean shares.
+     *
+     * The packed Beaver triples (see BooleanSecretSharing::GeneratePackedBeaverTriples) are
+     * consumed in round order: 'num' for the generate bits, then 2 * num for every layer
+     * of the adder except the last one, which uses 'num'.
+     *
+     * @param party The party object representing the current party.
+     * @param btp_vec The packed Beaver triples (GetA2BTripleCount() per value).
+     * @param x_vec The vector of additive shares.
+     * @param xb_vec The vector to store the packed Boolean shares.
+     */
+    void A2B(Party &party, const bts_t &btp_vec, const std::vector<uint32_t> &x_vec, std::vector<uint32_t> &xb_vec) const;
+
+    /**
+     * @brief Converts views of additive shares to packed Boolean shares.
+     *
+     * Same as the vector version, but the operands may be parts of larger buffers, and the
+     * number of values is the size of 'xb_vec'.
+     *
+     * @param party The party object representing the current party.
+     * @param btp_vec The packed Beaver triples (GetA2BTripleCount() per value).
+     * @param x_vec The additive shares of the values.
+     * @param xb_vec The view to store the packed Boolean shares of the values.
+     */
+    void A2B(Party &party, utils::Span<const BeaverTriplet> btp_vec, utils::Span<const uint32_t> x_vec, utils::Span<uint32_t> xb_vec) const;
+
+private:
+    const uint32_t             bitsize_;    /**< Bit size of the arithmetic ring. */
+    const uint32_t             num_layers_; /**< Number of layers of the parallel-prefix adder. */
+    const BooleanSecretSharing bss_;        /**< Boolean secret sharing for the adder. */
+};
+
+}    // namespace secret_sharing
+}    // namespace tools
+
+#endif    // SHARE_CONVERSION_H_
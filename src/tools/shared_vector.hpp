@@ -0,0 +1,309 @@
+#ifndef SHARED_VECTOR_H_
+#define SHARED_VECTOR_H_
+
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../utils/span.hpp"
+#include "../utils/thread_pool.hpp"
+
+namespace tools {
+namespace secret_sharing {
+
+/**
+ * @brief Ring Z_{2^Bitsize} of additive shares stored in 32-bit words.
+ *
+ * Reduction modulo 2^Bitsize commutes with wrapping 32-bit addition, subtraction and
+ * multiplication, so expressions are evaluated in uint32_t and reduced once when stored.
+ */
+template <uint32_t Bitsize>
+struct Z2k {
+    static_assert(Bitsize >= 2 && Bitsize <= 32, "The bit size must be between 2 and 32.");
+
+    static constexpr uint32_t kBitsize = Bitsize;
+
+    static constexpr uint32_t Add(const uint32_t x, const uint32_t y) {
+        return x + y;
+    }
+    static constexpr uint32_t Sub(const uint32_t x, const uint32_t y) {
+        return x - y;
+    }
+    static constexpr uint32_t Mul(const uint32_t x, const uint32_t c) {
+        return x * c;
+    }
+    static constexpr uint32_t Reduce(const uint32_t x) {
+        return (Bitsize == 32) ? x : (x & ((1U << (Bitsize % 32)) - 1));
+    }
+};
+
+/**
+ * @brief Ring GF(2)^32 of packed Boolean shares: addition is XOR and multiplication is AND.
+ */
+struct Z2 {
+    static constexpr uint32_t kBitsize = 1;
+
+    static constexpr uint32_t Add(const uint32_t x, const uint32_t y) {
+        return x ^ y;
+    }
+    static constexpr uint32_t Sub(const uint32_t x, const uint32_t y) {
+        return x ^ y;
+    }
+    static constexpr uint32_t Mul(const uint32_t x, const uint32_t c) {
+        return x & c;
+    }
+    static constexpr uint32_t Reduce(const uint32_t x) {
+        return x;
+    }
+};
+
+/**
+ * @brief Base of all share expressions over 'Ring' (CRTP).
+ *
+ * Expressions only hold references to their operands and compute element 'i' on demand,
+ * so a chain like a * 3 + b - c is evaluated in a single pass when it is assigned to a
+ * SharedVector. The SharedVector operands must outlive the expression.
+ */
+template <typename Ring, typename E>
+class SharedExpr {
+public:
+    using ring_t = Ring;
+
+    const E &Self() const {
+        return static_cast<const E &>(*this);
+    }
+
+    size_t size() const {
+        return this->Self().size();
+    }
+
+    uint32_t operator[](const size_t i) const {
+        return this->Self()[i];
+    }
+};
+
+template <typename Ring>
+class SharedVector;
+
+namespace internal {
+
+/**
+ * @brief Storage of an operand: vectors by reference, intermediate expressions by value.
+ *
+ * Holding nested nodes by value keeps an expression saved with 'auto' valid after the
+ * full expression that built it ends.
+ */
+template <typename E>
+struct Operand {
+    using type = const E;
+};
+
+template <typename Ring>
+struct Operand<SharedVector<Ring>> {
+    using type = const SharedVector<Ring> &;
+};
+
+struct AddOp {
+    template <typename Ring>
+    static constexpr uint32_t Apply(const uint32_t x, const uint32_t y) {
+        return Ring::Add(x, y);
+    }
+};
+
+struct SubOp {
+    template <typename Ring>
+    static constexpr uint32_t Apply(const uint32_t x, const uint32_t y) {
+        return Ring::Sub(x, y);
+    }
+};
+
+/**
+ * @brief Element-wise sum or difference of two expressions.
+ */
+template <typename Ring, typename L, typename R, typename Op>
+class BinaryExpr : public SharedExpr<Ring, BinaryExpr<Ring, L, R, Op>> {
+public:
+    BinaryExpr(const L &lhs, const R &rhs)
+        : lhs_(lhs), rhs_(rhs) {
+        if (lhs.size() != rhs.size()) {
+            throw std::invalid_argument("The sizes of the operands must match.");
+        }
+    }
+
+    size_t size() const {
+        return this->lhs_.size();
+    }
+
+    uint32_t operator[](const size_t i) const {
+        return Op::template Apply<Ring>(this->lhs_[i], this->rhs_[i]);
+    }
+
+private:
+    typename Operand<L>::type lhs_; /**< Left operand. */
+    typename Operand<R>::type rhs_; /**< Right operand. */
+};
+
+/**
+ * @brief Product of an expression with a public constant.
+ */
+template <typename Ring, typename E>
+class ScaleExpr : public SharedExpr<Ring, ScaleExpr<Ring, E>> {
+public:
+    ScaleExpr(const E &expr, const uint32_t c)
+        : expr_(expr), c_(c) {
+    }
+
+    size_t size() const {
+        return this->expr_.size();
+    }
+
+    uint32_t operator[](const size_t i) const {
+        return Ring::Mul(this->expr_[i], this->c_);
+    }
+
+private:
+    typename Operand<E>::type expr_; /**< Scaled expression. */
+    const uint32_t            c_;    /**< Public constant. */
+};
+
+}    // namespace internal
+
+/**
+ * @class SharedVector
+ * @brief A vector of shares over 'Ring' with fused linear operations.
+ *
+ * Addition, subtraction and multiplication by a public constant build expression templates
+ * instead of temporaries; assigning the expression (or constructing a SharedVector from it)
+ * evaluates it in one pass. The underlying std::vector is exposed through Get() so the
+ * result can be passed to Mult, And or Reconst directly.
+ *
+ * @tparam Ring The ring of the shares (e.g. Z2k<32> for additive shares or Z2 for packed Boolean shares).
+ */
+template <typename Ring>
+class SharedVector : public SharedExpr<Ring, SharedVector<Ring>> {
+public:
+    SharedVector() = default;
+
+    explicit SharedVector(const size_t size)
+        : data_(size) {
+    }
+
+    explicit SharedVector(std::vector<uint32_t> data)
+        : data_(std::move(data)) {
+    }
+
+    template <typename E>
+    SharedVector(const SharedExpr<Ring, E> &expr)
+        : data_(expr.size()) {
+        this->Assign(expr);
+    }
+
+    template <typename E>
+    SharedVector &operator=(const SharedExpr<Ring, E> &expr) {
+        this->data_.resize(expr.size());
+        this->Assign(expr);
+        return *this;
+    }
+
+    template <typename E>
+    SharedVector &operator+=(const SharedExpr<Ring, E> &expr) {
+        return *this = internal::BinaryExpr<Ring, SharedVector, E, internal::AddOp>(*this, expr.Self());
+    }
+
+    template <typename E>
+    SharedVector &operator-=(const SharedExpr<Ring, E> &expr) {
+        return *this = internal::BinaryExpr<Ring, SharedVector, E, internal::SubOp>(*this, expr.Self());
+    }
+
+    SharedVector &operator*=(const uint32_t c) {
+        return *this = internal::ScaleExpr<Ring, SharedVector>(*this, c);
+    }
+
+    /**
+     * @brief Evaluates an expression into this vector using the threads of a thread pool.
+     *
+     * @param expr The expression to be evaluated (same size as this vector).
+     * @param pool The thread pool running the chunks (e.g. Party::GetThreadPool()).
+     */
+    template <typename E>
+    void Assign(const SharedExpr<Ring, E> &expr, utils::ThreadPool &pool) {
+        this->data_.resize(expr.size());
+        const E &e = expr.Self();
+        pool.ParallelFor(this->data_.size(), [&](const uint32_t, const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                this->data_[i] = Ring::Reduce(e[i]);
+            }
+        });
+    }
+
+    size_t size() const {
+        return this->data_.size();
+    }
+
+    uint32_t operator[](const size_t i) const {
+        return this->data_[i];
+    }
+
+    uint32_t &operator[](const size_t i) {
+        return this->data_[i];
+    }
+
+    /**
+     * @brief Gets the underlying vector of shares.
+     */
+    std::vector<uint32_t> &Get() {
+        return this->data_;
+    }
+
+    const std::vector<uint32_t> &Get() const {
+        return this->data_;
+    }
+
+    operator utils::Span<uint32_t>() {
+        return utils::Span<uint32_t>(this->data_);
+    }
+
+    operator utils::Span<const uint32_t>() const {
+        return utils::Span<const uint32_t>(this->data_);
+    }
+
+private:
+    std::vector<uint32_t> data_; /**< Shares. */
+
+    /**
+     * @brief Evaluates an expression element by element; element 'i' only reads element 'i' of the operands, so aliasing is safe.
+     */
+    template <typename E>
+    void Assign(const SharedExpr<Ring, E> &expr) {
+        const E &e = expr.Self();
+        for (size_t i = 0; i < this->data_.size(); i++) {
+            this->data_[i] = Ring::Reduce(e[i]);
+        }
+    }
+};
+
+template <typename Ring, typename L, typename R>
+internal::BinaryExpr<Ring, L, R, internal::AddOp> operator+(const SharedExpr<Ring, L> &lhs, const SharedExpr<Ring, R> &rhs) {
+    return internal::BinaryExpr<Ring, L, R, internal::AddOp>(lhs.Self(), rhs.Self());
+}
+
+template <typename Ring, typename L, typename R>
+internal::BinaryExpr<Ring, L, R, internal::SubOp> operator-(const SharedExpr<Ring, L> &lhs, const SharedExpr<Ring, R> &rhs) {
+    return internal::BinaryExpr<Ring, L, R, internal::SubOp>(lhs.Self(), rhs.Self());
+}
+
+template <typename Ring, typename E>
+internal::ScaleExpr<Ring, E> operator*(const SharedExpr<Ring, E> &expr, const uint32_t c) {
+    return internal::ScaleExpr<Ring, E>(expr.Self(), c);
+}
+
+template <typename Ring, typename E>
+internal::ScaleExpr<Ring, E> operator*(const uint32_t c, const SharedExpr<Ring, E> &expr) {
+    return internal::ScaleExpr<Ring, E>(expr.Self(), c);
+}
+
+}    // namespace secret_sharing
+}    // namespace tools
+
+#endif    // SHARED_VECTOR_H_
@@ -0,0 +1,198 @@
+#include "triple_pool.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <stdexcept>
+
+#include "../utils/file_io.hpp"
+#include "../utils/logger.hpp"
+
+namespace tools {
+namespace secret_sharing {
+
+namespace {
+
+// Maximum number of triples produced per batch by the background thread
+constexpr uint32_t kProduceBatchSize = 1U << 14;
+
+}    // namespace
+
+TriplePool::TriplePool(const uint32_t capacity, const bool debug)
+    : capacity_(capacity), debug_(debug), ring_(capacity), cursor_(0), produced_(0), consumed_(0), finished_(false), stop_(false) {
+    if (capacity == 0) {
+        throw std::invalid_argument("The capacity of the triple pool must be greater than 0.");
+    }
+}
+
+TriplePool::~TriplePool() {
+    this->Stop();
+}
+
+void TriplePool::StartFromFile(const std::string &file_path, const std::string &ext) {
+    if (this->producer_.joinable()) {
+        throw std::logic_error("The triple pool has already been started.");
+    }
+    auto io   = std::make_shared<utils::FileIo>(this->debug_, ext);
+    auto file = std::make_shared<std::ifstream>();
+    if (!io->OpenFile(*file, file_path, LOCATION)) {
+        exit(EXIT_FAILURE);
+    }
+    // Read the number of triples from the first line of the file
+    uint64_t remaining = io->ReadNumCountFromFile(*file, LOCATION);
+    utils::Logger::TraceLog(LOCATION, "Triple pool reading " + std::to_string(remaining) + " triples from " + file_path + ext, this->debug_);
+
+    this->producer_ = std::thread([this, io, file, remaining]() mutable {
+        this->Produce([io, file, &remaining](const uint32_t max, bts_t &batch) {
+            std::string           line;
+            std::vector<uint32_t> vec;
+            while (remaining > 0 && batch.size() < max && std::getline(*file, line)) {
+                vec.clear();
+                io->SplitStringToUint32(line, vec);
+                if (vec.size() != 3) {
+                    utils::Logger::ErrorLog(LOCATION, "Malformed Beaver triple line in the triple file: \"" + line + "\"");
+                    remaining = 0;
+                    return false;
+                }
+                batch.push_back(BeaverTriplet(vec[0], vec[1], vec[2]));
+                remaining--;
+            }
+            return remaining > 0 && file->good();
+        });
+        file->close();
+    });
+}
+
+void TriplePool::StartFromGenerator(const triple_generator_t &generator, const uint64_t total) {
+    if (this->producer_.joinable()) {
+        throw std::logic_error("The triple pool has already been started.");
+    }
+    this->producer_ = std::thread([this, generator, total]() {
+        uint64_t generated = 0;
+        this->Produce([&generator, &generated, total](const uint32_t max, bts_t &batch) {
+            uint32_t num = max;
+            if (total > 0) {
+                num = static_cast<uint32_t>(std::min<uint64_t>(max, total - generated));
+            }
+            batch.resize(num);
+            generator(num, batch);
+            generated += num;
+            return total == 0 || generated < total;
+        });
+    });
+}
+
+void TriplePool::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->stop_ = true;
+    }
+    this->not_full_.notify_all();
+    this->not_empty_.notify_all();
+    if (this->producer_.joinable()) {
+        this->producer_.join();
+    }
+}
+
+BeaverTriplet TriplePool::Draw() {
+    BeaverTriplet bt;
+    this->DrawChunk(1, &bt);
+    return bt;
+}
+
+void TriplePool::Draw(const uint32_t num, bts_t &bt_vec) {
+    bt_vec.resize(num);
+    for (uint32_t offset = 0; offset < num; offset += this->capacity_) {
+        this->DrawChunk(std::min(this->capacity_, num - offset), bt_vec.data() + offset);
+    }
+}
+
+uint64_t TriplePool::GetNumAvailable() const {
+    uint64_t produced = this->produced_.load();
+    uint64_t cursor   = this->cursor_.load();
+    return (produced > cursor) ? produced - cursor : 0;
+}
+
+uint64_t TriplePool::GetNumConsumed() const {
+    return this->consumed_.load();
+}
+
+uint32_t TriplePool::GetCapacity() const {
+    return this->capacity_;
+}
+
+void TriplePool::Produce(const std::function<bool(const uint32_t max, bts_t &batch)> &fill) {
+    bts_t batch;
+    batch.reserve(std::min(this->capacity_, kProduceBatchSize));
+    bool has_more = true;
+    while (has_more && !this->stop_) {
+        // Wait until there is free space in the ring
+        uint64_t free_slots;
+        {
+            std::unique_lock<std::mutex> lock(this->mutex_);
+            this->not_full_.wait(lock, [this]() {
+                return this->stop_ || this->produced_ - this->consumed_ < this->capacity_;
+            });
+            if (this->stop_) {
+                break;
+            }
+            free_slots = this->capacity_ - (this->produced_ - this->consumed_);
+        }
+        // Fill the batch outside of the lock so that consumers are not blocked
+        batch.clear();
+        has_more = fill(static_cast<uint32_t>(std::min<uint64_t>(free_slots, kProduceBatchSize)), batch);
+        uint64_t produced = this->produced_.load();
+        for (size_t i = 0; i < batch.size(); i++) {
+            this->ring_[(produced + i) % this->capacity_] = batch[i];
+        }
+        {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+            this->produced_ += batch.size();
+        }
+        this->not_empty_.notify_all();
+    }
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->finished_ = true;
+    }
+    this->not_empty_.notify_all();
+    utils::Logger::TraceLog(LOCATION, "Triple pool producer finished after " + std::to_string(this->produced_.load()) + " triples", this->debug_);
+}
+
+void TriplePool::DrawChunk(const uint32_t num, BeaverTriplet *out) {
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    // Wait until 'num' unclaimed triples have been produced; the cursor only moves once the
+    // claim can be served, so a failed draw leaves the pool usable for smaller draws
+    this->not_empty_.wait(lock, [this, num]() {
+        return this->stop_ || this->produced_ >= this->cursor_ + num || this->finished_;
+    });
+    if (this->stop_ || this->produced_ < this->cursor_ + num) {
+        throw std::runtime_error("The triple pool is exhausted or has been stopped.");
+    }
+    const uint64_t start = this->cursor_.fetch_add(num);
+    const uint64_t end   = start + num;
+    lock.unlock();
+
+    // Copy outside of the lock, so that concurrent consumers copy their ranges in parallel
+    for (uint64_t i = start; i < end; i++) {
+        out[i - start] = this->ring_[i % this->capacity_];
+    }
+
+    // Release the range; ranges copied out of order are merged once all earlier ranges are released,
+    // so that the producer never overwrites a slot that is still being copied
+    lock.lock();
+    this->released_.emplace(start, end);
+    bool advanced = false;
+    for (auto it = this->released_.begin(); it != this->released_.end() && it->first == this->consumed_; it = this->released_.erase(it)) {
+        this->consumed_ = it->second;
+        advanced        = true;
+    }
+    lock.unlock();
+    if (advanced) {
+        this->not_full_.notify_all();
+    }
+}
+
+}    // namespace secret_sharing
+}    // namespace tools
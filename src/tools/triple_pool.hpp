@@ -0,0 +1,143 @@
+#ifndef TRIPLE_POOL_H_
+#define TRIPLE_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "secret_sharing.hpp"
+
+namespace tools {
+namespace secret_sharing {
+
+/**
+ * @brief Function that produces 'num' Beaver triple shares for the calling party into 'bt_vec'.
+ */
+using triple_generator_t = std::function<void(const uint32_t num, bts_t &bt_vec)>;
+
+/**
+ * @class TriplePool
+ * @brief Bounded ring of Beaver triple shares filled on a background thread.
+ *
+ * The pool is filled from a triple file written by ShareHandler::ExportBTShare or from a
+ * generator function, while the online phase draws triples through an atomic cursor.
+ * Consumers block only when the ring is empty, and the producer blocks while the ring is
+ * full, so memory usage stays bounded by the capacity.
+ */
+class TriplePool {
+public:
+    /**
+     * @brief Constructs a TriplePool with the specified capacity.
+     *
+     * @param capacity The maximum number of triples held in memory.
+     * @param debug Flag indicating whether to print debug messages.
+     */
+    TriplePool(const uint32_t capacity, const bool debug = false);
+
+    /**
+     * @brief Stops the background thread and destroys the TriplePool.
+     */
+    ~TriplePool();
+
+    TriplePool(const TriplePool &)            = delete;
+    TriplePool &operator=(const TriplePool &) = delete;
+
+    /**
+     * @brief Starts filling the pool from a Beaver triple share file.
+     *
+     * The file is read incrementally in the format written by ShareHandler::ExportBTShare.
+     *
+     * @param file_path The file path from which to read the Beaver triple shares.
+     * @param ext The file extension of the triple file.
+     */
+    void StartFromFile(const std::string &file_path, const std::string &ext = ".dat");
+
+    /**
+     * @brief Starts filling the pool from a generator function.
+     *
+     * @param generator The function producing batches of Beaver triple shares.
+     * @param total The total number of triples to generate (0 for unlimited).
+     */
+    void StartFromGenerator(const triple_generator_t &generator, const uint64_t total = 0);
+
+    /**
+     * @brief Stops the background thread.
+     *
+     * Consumers waiting for triples are woken up and fail with std::runtime_error.
+     */
+    void Stop();
+
+    /**
+     * @brief Draws a single Beaver triple share.
+     *
+     * Blocks until a triple is available.
+     *
+     * @return The drawn Beaver triple share.
+     */
+    BeaverTriplet Draw();
+
+    /**
+     * @brief Draws multiple Beaver triple shares.
+     *
+     * Claims 'num' consecutive triples once they are available and copies them into 'bt_vec'.
+     * Concurrent consumers copy their claims in parallel and release them in any order.
+     * Requests larger than the capacity are served in capacity-sized chunks.
+     *
+     * @param num The number of triples to draw.
+     * @param bt_vec The vector to store the drawn triples (resized to 'num').
+     */
+    void Draw(const uint32_t num, bts_t &bt_vec);
+
+    /**
+     * @brief Gets the number of triples that are ready to be drawn.
+     */
+    uint64_t GetNumAvailable() const;
+
+    /**
+     * @brief Gets the total number of triples drawn so far.
+     */
+    uint64_t GetNumConsumed() const;
+
+    /**
+     * @brief Gets the capacity of the pool.
+     */
+    uint32_t GetCapacity() const;
+
+private:
+    const uint32_t          capacity_;  /**< Maximum number of triples held in memory. */
+    const bool              debug_;     /**< Flag indicating whether to print debug messages. */
+    bts_t                   ring_;      /**< Ring buffer of triples. */
+    std::atomic<uint64_t>   cursor_;    /**< Next triple index to be claimed by a consumer. */
+    std::atomic<uint64_t>   produced_;  /**< Number of triples written to the ring. */
+    std::atomic<uint64_t>   consumed_;  /**< Number of triples copied out of the ring (contiguous prefix). */
+    std::map<uint64_t, uint64_t> released_; /**< Ranges copied out of order, not yet merged into consumed_. */
+    std::atomic<bool>       finished_;  /**< Flag indicating that the source is exhausted. */
+    std::atomic<bool>       stop_;      /**< Flag requesting the producer to stop. */
+    std::mutex              mutex_;     /**< Mutex guarding the condition variables. */
+    std::condition_variable not_empty_; /**< Signalled when triples are produced. */
+    std::condition_variable not_full_;  /**< Signalled when triples are consumed. */
+    std::thread             producer_;  /**< Background producer thread. */
+
+    /**
+     * @brief Runs the producer loop.
+     *
+     * @param fill Function that writes up to 'max' triples into 'batch' and returns false when the source is exhausted.
+     */
+    void Produce(const std::function<bool(const uint32_t max, bts_t &batch)> &fill);
+
+    /**
+     * @brief Claims and copies a chunk of at most 'capacity_' triples.
+     */
+    void DrawChunk(const uint32_t num, BeaverTriplet *out);
+};
+
+}    // namespace secret_sharing
+}    // namespace tools
+
+#endif    // TRIPLE_POOL_H_
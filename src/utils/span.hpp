@@ -0,0 +1,101 @@
+/**
+ * @file span.hpp
+ * @brief Non-owning view over contiguous memory.
+ */
+
+#ifndef UTILS_SPAN_H_
+#define UTILS_SPAN_H_
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace utils {
+
+/**
+ * @class Span
+ * @brief A pointer and a length referring to contiguous elements owned elsewhere.
+ *
+ * A minimal subset of C++20 std::span for this C++17 code base. A Span<T> converts
+ * implicitly to a Span<const T>, so functions that only read a buffer take Span<const T>
+ * and accept vectors, arrays and workspace buffers alike without copying.
+ */
+template <typename T>
+class Span {
+public:
+    using element_type = T;
+    using value_type   = std::remove_cv_t<T>;
+
+    constexpr Span() noexcept
+        : data_(nullptr), size_(0) {
+    }
+
+    constexpr Span(T *data, const size_t size) noexcept
+        : data_(data), size_(size) {
+    }
+
+    template <typename U, typename = std::enable_if_t<std::is_convertible<U (*)[], T (*)[]>::value>>
+    constexpr Span(const Span<U> &other) noexcept
+        : data_(other.data()), size_(other.size()) {
+    }
+
+    template <typename U, typename A, typename = std::enable_if_t<std::is_convertible<U (*)[], T (*)[]>::value>>
+    Span(std::vector<U, A> &vec) noexcept
+        : data_(vec.data()), size_(vec.size()) {
+    }
+
+    template <typename U, typename A, typename = std::enable_if_t<std::is_convertible<const U (*)[], T (*)[]>::value>>
+    Span(const std::vector<U, A> &vec) noexcept
+        : data_(vec.data()), size_(vec.size()) {
+    }
+
+    template <typename U, size_t N, typename = std::enable_if_t<std::is_convertible<U (*)[], T (*)[]>::value>>
+    constexpr Span(std::array<U, N> &arr) noexcept
+        : data_(arr.data()), size_(N) {
+    }
+
+    template <typename U, size_t N, typename = std::enable_if_t<std::is_convertible<const U (*)[], T (*)[]>::value>>
+    constexpr Span(const std::array<U, N> &arr) noexcept
+        : data_(arr.data()), size_(N) {
+    }
+
+    constexpr T *data() const noexcept {
+        return this->data_;
+    }
+
+    constexpr size_t size() const noexcept {
+        return this->size_;
+    }
+
+    constexpr bool empty() const noexcept {
+        return this->size_ == 0;
+    }
+
+    constexpr T &operator[](const size_t i) const noexcept {
+        return this->data_[i];
+    }
+
+    constexpr T *begin() const noexcept {
+        return this->data_;
+    }
+
+    constexpr T *end() const noexcept {
+        return this->data_ + this->size_;
+    }
+
+    /**
+     * @brief Gets the view of 'count' elements starting at 'offset'.
+     */
+    constexpr Span subspan(const size_t offset, const size_t count) const noexcept {
+        return Span(this->data_ + offset, count);
+    }
+
+private:
+    T     *data_; /**< First element of the view. */
+    size_t size_; /**< Number of elements of the view. */
+};
+
+}    // namespace utils
+
+#endif    // UTILS_SPAN_H_
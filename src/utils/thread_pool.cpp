@@ -0,0 +1,106 @@
+/**
+ * @file thread_pool.cpp
+ * @brief Thread pool implementation.
+ */
+
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace utils {
+
+namespace {
+
+thread_local bool in_parallel_for = false;    // Whether the current thread is executing a chunk
+
+}    // namespace
+
+ThreadPool::ThreadPool(const uint32_t num_threads)
+    : num_threads_(num_threads), job_(nullptr), stop_(false) {
+    if (num_threads == 0) {
+        throw std::invalid_argument("The number of threads must be greater than 0.");
+    }
+    // The calling thread executes chunks as well, so only 'num_threads - 1' workers are needed
+    for (uint32_t i = 1; i < num_threads; i++) {
+        this->workers_.emplace_back(&ThreadPool::Work, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(this->mutex_);
+        this->stop_ = true;
+    }
+    this->work_cv_.notify_all();
+    for (std::thread &worker : this->workers_) {
+        worker.join();
+    }
+}
+
+uint32_t ThreadPool::GetNumThreads() const {
+    return this->num_threads_;
+}
+
+uint32_t ThreadPool::GetNumChunks(const size_t num, const size_t min_chunk_size) const {
+    size_t max_chunks = std::max<size_t>(num / std::max<size_t>(min_chunk_size, 1), 1);
+    return static_cast<uint32_t>(std::min<size_t>(this->num_threads_, max_chunks));
+}
+
+void ThreadPool::Run(Job &job) {
+    if (in_parallel_for) {
+        // Nested loop: the workers are busy with the outer loop, so run all chunks inline
+        for (uint32_t chunk_id = 0; chunk_id < job.num_chunks; chunk_id++) {
+            job.invoke(job.ctx, chunk_id, job.num * chunk_id / job.num_chunks, job.num * (chunk_id + 1) / job.num_chunks);
+        }
+        return;
+    }
+    std::lock_guard<std::mutex>  run_lock(this->run_mutex_);
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    this->job_ = &job;
+    this->work_cv_.notify_all();
+    this->ExecuteChunks(lock);
+    this->done_cv_.wait(lock, [&job]() { return job.num_done == job.num_chunks; });
+    this->job_ = nullptr;
+    lock.unlock();
+    if (job.error) {
+        std::rethrow_exception(job.error);
+    }
+}
+
+void ThreadPool::ExecuteChunks(std::unique_lock<std::mutex> &lock) {
+    Job *job = this->job_;
+    while (job->next_chunk < job->num_chunks) {
+        const uint32_t chunk_id = job->next_chunk++;
+        lock.unlock();
+        std::exception_ptr error;
+        in_parallel_for = true;
+        try {
+            job->invoke(job->ctx, chunk_id, job->num * chunk_id / job->num_chunks, job->num * (chunk_id + 1) / job->num_chunks);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        in_parallel_for = false;
+        lock.lock();
+        if (error && !job->error) {
+            job->error = error;
+        }
+        // The job must not be touched after the last chunk is reported, since its owner may return
+        if (++job->num_done == job->num_chunks) {
+            this->done_cv_.notify_all();
+        }
+    }
+}
+
+void ThreadPool::Work() {
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    while (true) {
+        this->work_cv_.wait(lock, [this]() { return this->stop_ || (this->job_ != nullptr && this->job_->next_chunk < this->job_->num_chunks); });
+        if (this->stop_) {
+            return;
+        }
+        this->ExecuteChunks(lock);
+    }
+}
+
+}    // namespace utils
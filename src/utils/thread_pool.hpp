@@ -0,0 +1,137 @@
+/**
+ * @file thread_pool.hpp
+ * @brief Thread pool class.
+ */
+
+#ifndef UTILS_THREAD_POOL_H_
+#define UTILS_THREAD_POOL_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace utils {
+
+/**
+ * @class ThreadPool
+ * @brief A fixed-size pool of worker threads for data-parallel loops.
+ *
+ * ParallelFor splits an index range into contiguous chunks that the calling thread and the
+ * workers claim one at a time, and returns once all chunks are done. Loops are dispatched
+ * without heap allocation, and a pool with a single thread (or a range shorter than the
+ * minimum chunk size) runs the loop inline on the calling thread. Calls from inside a
+ * running loop are executed inline as well.
+ */
+class ThreadPool {
+public:
+    static constexpr size_t kMinChunkSize = 1U << 14;    // Default minimum number of elements per chunk
+
+    /**
+     * @brief Constructs a ThreadPool with the specified number of threads.
+     *
+     * @param num_threads The number of threads including the calling thread.
+     */
+    explicit ThreadPool(const uint32_t num_threads = 1);
+
+    /**
+     * @brief Joins the worker threads and destroys the ThreadPool.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &)            = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * @brief Gets the number of threads including the calling thread.
+     */
+    uint32_t GetNumThreads() const;
+
+    /**
+     * @brief Gets the number of chunks ParallelFor uses for a range.
+     *
+     * @param num The number of elements of the range.
+     * @param min_chunk_size The minimum number of elements per chunk.
+     * @return The number of chunks (at least 1).
+     */
+    uint32_t GetNumChunks(const size_t num, const size_t min_chunk_size = kMinChunkSize) const;
+
+    /**
+     * @brief Runs 'func(chunk_id, begin, end)' on contiguous chunks of [0, num) in parallel.
+     *
+     * The chunk boundaries depend only on 'num', 'min_chunk_size' and the number of threads,
+     * so per-chunk state (e.g. one PRG per chunk) can be prepared by the caller in advance.
+     * An exception thrown by any chunk is rethrown on the calling thread.
+     *
+     * @param num The number of elements of the range.
+     * @param func The function processing one chunk.
+     * @param min_chunk_size The minimum number of elements per chunk.
+     */
+    template <typename Func>
+    void ParallelFor(const size_t num, Func &&func, const size_t min_chunk_size = kMinChunkSize) {
+        using func_t              = std::remove_reference_t<Func>;
+        const uint32_t num_chunks = this->GetNumChunks(num, min_chunk_size);
+        if (num_chunks == 1) {
+            func(0U, size_t(0), num);
+            return;
+        }
+        Job job(num, num_chunks, std::addressof(func), [](const void *ctx, const uint32_t chunk_id, const size_t begin, const size_t end) {
+            (*static_cast<func_t *>(const_cast<void *>(ctx)))(chunk_id, begin, end);
+        });
+        this->Run(job);
+    }
+
+private:
+    /**
+     * @brief A loop being executed, owned by the stack frame of ParallelFor.
+     */
+    struct Job {
+        using invoke_t = void (*)(const void *ctx, const uint32_t chunk_id, const size_t begin, const size_t end);
+
+        Job(const size_t n, const uint32_t chunks, const void *c, const invoke_t f)
+            : num(n), num_chunks(chunks), ctx(c), invoke(f), next_chunk(0), num_done(0) {
+        }
+
+        const size_t       num;        /**< Number of elements of the range. */
+        const uint32_t     num_chunks; /**< Number of chunks. */
+        const void        *ctx;        /**< Loop body. */
+        const invoke_t     invoke;     /**< Type-erased call of the loop body. */
+        uint32_t           next_chunk; /**< Next chunk to be claimed (guarded by mutex_). */
+        uint32_t           num_done;   /**< Number of finished chunks (guarded by mutex_). */
+        std::exception_ptr error;      /**< First exception thrown by a chunk (guarded by mutex_). */
+    };
+
+    const uint32_t           num_threads_; /**< Number of threads including the calling thread. */
+    std::vector<std::thread> workers_;     /**< Worker threads. */
+    std::mutex               run_mutex_;   /**< Mutex serializing loops started from different threads. */
+    std::mutex               mutex_;       /**< Mutex guarding the current job. */
+    std::condition_variable  work_cv_;     /**< Signalled when a job is published or the pool stops. */
+    std::condition_variable  done_cv_;     /**< Signalled when the last chunk of a job finishes. */
+    Job                     *job_;         /**< Job being executed (nullptr when idle). */
+    bool                     stop_;        /**< Flag requesting the workers to stop. */
+
+    /**
+     * @brief Publishes a job, helps executing it and waits until all chunks are done.
+     */
+    void Run(Job &job);
+
+    /**
+     * @brief Claims and executes chunks of the current job until none are left.
+     *
+     * @param lock The lock on 'mutex_', held on entry and on return.
+     */
+    void ExecuteChunks(std::unique_lock<std::mutex> &lock);
+
+    /**
+     * @brief Runs the worker loop.
+     */
+    void Work();
+};
+
+}    // namespace utils
+
+#endif    // UTILS_THREAD_POOL_H_
@@ -0,0 +1,89 @@
+/**
+ * @file workspace.cpp
+ * @brief Scratch-buffer arena implementation.
+ */
+
+#include "workspace.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+namespace utils {
+
+namespace {
+
+constexpr size_t kWordsPerLine = Workspace::kAlignment / sizeof(uint32_t);    // Number of words per aligned line
+
+}    // namespace
+
+Workspace::Frame::Frame(Workspace &workspace)
+    : workspace_(workspace), block_index_(workspace.block_index_), offset_(workspace.offset_) {
+}
+
+Workspace::Frame::~Frame() {
+    this->workspace_.Release(this->block_index_, this->offset_);
+}
+
+Workspace::Workspace(const size_t initial_words)
+    : block_index_(0), offset_(0) {
+    if (initial_words > 0) {
+        this->AddBlock(initial_words);
+    }
+}
+
+Workspace::~Workspace() {
+    for (Block &block : this->blocks_) {
+        std::free(block.data);
+    }
+}
+
+uint32_t *Workspace::Allocate(const size_t num_words) {
+    // Round up so that the next buffer stays aligned
+    const size_t padded = std::max<size_t>((num_words + kWordsPerLine - 1) / kWordsPerLine * kWordsPerLine, kWordsPerLine);
+    // Skip to the first later block with enough free space
+    while (this->block_index_ < this->blocks_.size() && this->offset_ + padded > this->blocks_[this->block_index_].num_words) {
+        this->block_index_++;
+        this->offset_ = 0;
+    }
+    if (this->block_index_ == this->blocks_.size()) {
+        // Grow geometrically so that the number of blocks stays logarithmic
+        this->AddBlock(std::max(padded, this->GetCapacity()));
+    }
+    uint32_t *buffer = this->blocks_[this->block_index_].data + this->offset_;
+    this->offset_ += padded;
+    return buffer;
+}
+
+size_t Workspace::GetCapacity() const {
+    size_t capacity = 0;
+    for (const Block &block : this->blocks_) {
+        capacity += block.num_words;
+    }
+    return capacity;
+}
+
+void Workspace::AddBlock(const size_t num_words) {
+    const size_t padded = (num_words + kWordsPerLine - 1) / kWordsPerLine * kWordsPerLine;
+    void        *data   = std::aligned_alloc(kAlignment, padded * sizeof(uint32_t));
+    if (data == nullptr) {
+        throw std::bad_alloc();
+    }
+    this->blocks_.push_back(Block{static_cast<uint32_t *>(data), padded});
+}
+
+void Workspace::Release(const size_t block_index, const size_t offset) {
+    this->block_index_ = block_index;
+    this->offset_      = offset;
+    if (block_index == 0 && offset == 0 && this->blocks_.size() > 1) {
+        // Merge all blocks into one, so that the same sequence of requests fits in a single block next time
+        const size_t capacity = this->GetCapacity();
+        for (Block &block : this->blocks_) {
+            std::free(block.data);
+        }
+        this->blocks_.clear();
+        this->AddBlock(capacity);
+    }
+}
+
+}    // namespace utils
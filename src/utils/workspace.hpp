@@ -0,0 +1,101 @@
+/**
+ * @file workspace.hpp
+ * @brief Scratch-buffer arena class.
+ */
+
+#ifndef UTILS_WORKSPACE_H_
+#define UTILS_WORKSPACE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace utils {
+
+/**
+ * @class Workspace
+ * @brief Bump allocator handing out aligned scratch buffers for protocol temporaries.
+ *
+ * Buffers are carved out of large blocks and released together when the enclosing Frame
+ * goes out of scope. When the outermost frame is released and the arena had to grow, the
+ * blocks are merged into one block of the total size, so after the first call of a given
+ * size the arena serves every request without touching the heap.
+ * A Workspace is used by one thread at a time.
+ */
+class Workspace {
+public:
+    static constexpr size_t kAlignment = 64;    // Alignment of every buffer in bytes (one cache line)
+
+    /**
+     * @class Frame
+     * @brief Scope guard that releases all buffers allocated after its construction.
+     */
+    class Frame {
+    public:
+        explicit Frame(Workspace &workspace);
+        ~Frame();
+
+        Frame(const Frame &)            = delete;
+        Frame &operator=(const Frame &) = delete;
+
+    private:
+        Workspace &workspace_;   /**< Workspace the frame belongs to. */
+        size_t     block_index_; /**< Block index at the construction of the frame. */
+        size_t     offset_;      /**< Offset in the block at the construction of the frame. */
+    };
+
+    /**
+     * @brief Constructs a Workspace with an optional initial capacity.
+     *
+     * @param initial_words The initial capacity in 32-bit words.
+     */
+    explicit Workspace(const size_t initial_words = 0);
+
+    /**
+     * @brief Frees all blocks and destroys the Workspace.
+     */
+    ~Workspace();
+
+    Workspace(const Workspace &)            = delete;
+    Workspace &operator=(const Workspace &) = delete;
+
+    /**
+     * @brief Allocates an uninitialized buffer of 'num_words' 32-bit words.
+     *
+     * The buffer is aligned to kAlignment bytes and stays valid until the innermost
+     * enclosing Frame is released.
+     *
+     * @param num_words The number of 32-bit words.
+     * @return A pointer to the buffer.
+     */
+    uint32_t *Allocate(const size_t num_words);
+
+    /**
+     * @brief Gets the total capacity of the arena in 32-bit words.
+     */
+    size_t GetCapacity() const;
+
+private:
+    struct Block {
+        uint32_t *data;      /**< Aligned storage of the block. */
+        size_t    num_words; /**< Capacity of the block in 32-bit words. */
+    };
+
+    std::vector<Block> blocks_;      /**< Blocks of the arena in allocation order. */
+    size_t             block_index_; /**< Index of the block currently being filled. */
+    size_t             offset_;      /**< Number of words used in the current block. */
+
+    /**
+     * @brief Appends a new block of at least 'num_words' words.
+     */
+    void AddBlock(const size_t num_words);
+
+    /**
+     * @brief Rewinds the arena to a previous position and merges the blocks if it is empty.
+     */
+    void Release(const size_t block_index, const size_t offset);
+};
+
+}    // namespace utils
+
+#endif    // UTILS_WORKSPACE_H_